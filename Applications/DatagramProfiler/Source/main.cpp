@@ -0,0 +1,111 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Network/UdpSocket.hpp"
+#include "Beam/Routines/RoutineHandler.hpp"
+#include "Version.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Network;
+using namespace Beam::Routines;
+
+namespace {
+  const auto ADDRESS = IpAddress("127.0.0.1", 20919);
+  const auto DEFAULT_PACKET_COUNT = 1000000;
+  const auto PACKET_SIZE = std::size_t(64);
+
+  UdpSocketOptions MakeOptions() {
+    auto options = UdpSocketOptions();
+    options.m_timeout = boost::posix_time::milliseconds(500);
+    options.m_receiveBufferSize = 8 * 1024 * 1024;
+    return options;
+  }
+
+  std::vector<DatagramPacket<SharedBuffer>> MakePackets(std::size_t count) {
+    auto packets = std::vector<DatagramPacket<SharedBuffer>>();
+    for(auto i = std::size_t(0); i != count; ++i) {
+      packets.emplace_back(
+        BufferFromString<SharedBuffer>(std::string(PACKET_SIZE, 'a')),
+        ADDRESS);
+    }
+    return packets;
+  }
+
+  void Report(const char* name, int sent, int received,
+      std::chrono::steady_clock::time_point start,
+      std::chrono::steady_clock::time_point end) {
+    auto elapsed = std::chrono::duration<double>(end - start).count();
+    std::cout << name << ": " << sent << " sent, " << received <<
+      " received, " << elapsed << "s, " << (received / elapsed) <<
+      " packets/s" << std::endl;
+  }
+
+  void ProfileSingle(int count) {
+    auto receiver = UdpSocket(ADDRESS, ADDRESS, MakeOptions());
+    auto sender = UdpSocket(ADDRESS, MakeOptions());
+    auto packet = MakePackets(1).front();
+    auto start = std::chrono::steady_clock::now();
+    auto end = start;
+    auto received = 0;
+    auto senderRoutine = RoutineHandler(Spawn([&] {
+      for(auto i = 0; i < count; ++i) {
+        sender.GetSender().Send(packet);
+      }
+    }));
+    try {
+      auto destination = DatagramPacket<SharedBuffer>();
+      while(received < count) {
+        destination.GetData().Reset();
+        receiver.GetReceiver().Receive(Store(destination));
+        ++received;
+        end = std::chrono::steady_clock::now();
+      }
+    } catch(const EndOfFileException&) {}
+    senderRoutine.Wait();
+    Report("ProfileSingle", count, received, start, end);
+  }
+
+  void ProfileBatch(int count, std::size_t batchSize) {
+    auto receiver = UdpSocket(ADDRESS, ADDRESS, MakeOptions());
+    auto sender = UdpSocket(ADDRESS, MakeOptions());
+    auto packets = MakePackets(batchSize);
+    auto start = std::chrono::steady_clock::now();
+    auto end = start;
+    auto received = 0;
+    auto senderRoutine = RoutineHandler(Spawn([&] {
+      for(auto i = 0; i < count; i += static_cast<int>(batchSize)) {
+        sender.GetSender().Send(packets);
+      }
+    }));
+    try {
+      auto destination = std::vector<DatagramPacket<SharedBuffer>>();
+      while(received < count) {
+        destination.clear();
+        received += static_cast<int>(
+          receiver.GetReceiver().Receive(Store(destination), batchSize));
+        end = std::chrono::steady_clock::now();
+      }
+    } catch(const EndOfFileException&) {}
+    senderRoutine.Wait();
+    auto name = "ProfileBatch(" + std::to_string(batchSize) + ")";
+    Report(name.c_str(), count, received, start, end);
+  }
+}
+
+int main(int argc, const char** argv) {
+  std::cout << "DatagramProfiler 1.0-r" DATAGRAM_PROFILER_VERSION <<
+    std::endl;
+  auto packetCount = DEFAULT_PACKET_COUNT;
+  if(argc > 1) {
+    packetCount = boost::lexical_cast<int>(argv[1]);
+  }
+  ProfileSingle(packetCount);
+  ProfileBatch(packetCount, 8);
+  ProfileBatch(packetCount, 64);
+  return 0;
+}
@@ -1,25 +1,528 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include "Beam/Queues/CallbackQueue.hpp"
+#include "Beam/Queues/MpscQueue.hpp"
+#include "Beam/Queues/MultiQueueWriter.hpp"
+#include "Beam/Queues/Queue.hpp"
+#include "Beam/Queues/QueueWriterPublisher.hpp"
+#include "Beam/Queues/RoutineTaskQueue.hpp"
+#include "Beam/Queues/SpscQueue.hpp"
 #include "Beam/Queues/StateQueue.hpp"
 #include "Beam/Routines/RoutineHandlerGroup.hpp"
 
 using namespace Beam;
 using namespace Beam::Routines;
 
-int main() {
-  auto routines = RoutineHandlerGroup();
-  auto receiverQueue = std::make_shared<StateQueue<int>>();
-  auto senderQueue = std::make_shared<StateQueue<bool>>();
-  routines.Spawn([=] {
-    while(true) {
-      receiverQueue->Push(123);
-      senderQueue->Pop();
-    }
-  });
-  for(auto j = 0; j < 200; ++j) {
+namespace {
+  auto allocationCount = std::atomic<std::uint64_t>(0);
+}
+
+void* operator new(std::size_t size) {
+  allocationCount.fetch_add(1, std::memory_order_relaxed);
+  if(auto p = std::malloc(size)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+  std::free(p);
+}
+
+namespace {
+  const auto MESSAGE_COUNT = 1000000;
+  const auto ROUND_TRIP_COUNT = 100000;
+  const auto PRODUCER_COUNT = 4;
+  const auto CONSUMER_COUNT = 4;
+  const auto FAN_OUT_COUNT = 16;
+  const auto PUBLISH_COUNT = 100000;
+  const auto WIDE_FAN_OUT_COUNT = 1000;
+  const auto WIDE_PUBLISH_COUNT = 1000;
+  const auto END_OF_STREAM = std::int64_t(-1);
+
+  /** Specifies where producers and consumers run. */
+  enum class Boundary {
+
+    /** Producers and consumers are Routines. */
+    ROUTINE,
+
+    /** Producers and consumers are dedicated threads. */
+    THREAD,
+
+    /** Producers are dedicated threads, consumers are Routines. */
+    MIXED
+  };
+
+  const char* ToString(Boundary boundary) {
+    if(boundary == Boundary::ROUTINE) {
+      return "routine";
+    } else if(boundary == Boundary::THREAD) {
+      return "thread";
+    }
+    return "mixed";
+  }
+
+  /** Stores the measurements taken by a single benchmark run. */
+  struct Result {
+
+    /** The name of the benchmark. */
+    std::string m_benchmark;
+
+    /** Where producers and consumers ran. */
+    Boundary m_boundary;
+
+    /** The number of producers. */
+    int m_producers;
+
+    /** The number of consumers. */
+    int m_consumers;
+
+    /** The number of values handed off. */
+    std::uint64_t m_operations;
+
+    /** The elapsed wall time in seconds. */
+    double m_seconds;
+
+    /** The number of heap allocations made while running. */
+    std::uint64_t m_allocations;
+
+    /** The hand-off latency of every value, in nanoseconds. */
+    std::vector<std::int64_t> m_latencies;
+  };
+
+  /** Runs producers and consumers on either Routines or threads. */
+  class Workers {
+    public:
+
+      /**
+       * Constructs Workers.
+       * @param boundary Where producers and consumers run.
+       */
+      explicit Workers(Boundary boundary)
+        : m_boundary(boundary) {}
+
+      /** Spawns a producer. */
+      template<typename F>
+      void SpawnProducer(F&& f) {
+        if(m_boundary == Boundary::ROUTINE) {
+          m_routines.Spawn(std::forward<F>(f));
+        } else {
+          m_threads.emplace_back(std::forward<F>(f));
+        }
+      }
+
+      /** Spawns a consumer. */
+      template<typename F>
+      void SpawnConsumer(F&& f) {
+        if(m_boundary == Boundary::THREAD) {
+          m_threads.emplace_back(std::forward<F>(f));
+        } else {
+          m_routines.Spawn(std::forward<F>(f));
+        }
+      }
+
+      /** Waits for all producers and consumers to complete. */
+      void Wait() {
+        for(auto& thread : m_threads) {
+          thread.join();
+        }
+        m_threads.clear();
+        m_routines.Wait();
+      }
+
+    private:
+      Boundary m_boundary;
+      RoutineHandlerGroup m_routines;
+      std::vector<std::thread> m_threads;
+  };
+
+  /** Collects latency samples from concurrent consumers. */
+  class LatencyLog {
+    public:
+
+      /**
+       * Constructs a LatencyLog.
+       * @param capacity The number of samples expected.
+       */
+      explicit LatencyLog(std::size_t capacity) {
+        m_samples.reserve(capacity);
+      }
+
+      /** Returns a buffer a single consumer can record into. */
+      std::vector<std::int64_t> MakeBuffer(std::size_t capacity) const {
+        auto buffer = std::vector<std::int64_t>();
+        buffer.reserve(capacity);
+        return buffer;
+      }
+
+      /** Appends a consumer's samples. */
+      void Merge(const std::vector<std::int64_t>& samples) {
+        auto lock = boost::lock_guard(m_mutex);
+        m_samples.insert(m_samples.end(), samples.begin(), samples.end());
+      }
+
+      /** Appends a single sample. */
+      void Record(std::int64_t sample) {
+        m_samples.push_back(sample);
+      }
+
+      /** Returns all samples collected. */
+      std::vector<std::int64_t>& GetSamples() {
+        return m_samples;
+      }
+
+    private:
+      boost::mutex m_mutex;
+      std::vector<std::int64_t> m_samples;
+  };
+
+  std::int64_t Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  /** Measures the time and allocations spent running a benchmark. */
+  class Stopwatch {
+    public:
+      Stopwatch()
+        : m_allocations(allocationCount.load()),
+          m_start(std::chrono::steady_clock::now()) {}
+
+      /** Stores the elapsed time and allocations into a Result. */
+      void Stop(Result& result) const {
+        result.m_seconds = std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - m_start).count();
+        result.m_allocations = allocationCount.load() - m_allocations;
+      }
+
+    private:
+      std::uint64_t m_allocations;
+      std::chrono::steady_clock::time_point m_start;
+  };
+
+  std::string g_filter;
+
+  bool IsSelected(const std::string& name) {
+    return g_filter.empty() || name.find(g_filter) != std::string::npos;
+  }
+
+  /** Prints a Result as a single line of JSON. */
+  void Report(Result& result) {
+    auto& latencies = result.m_latencies;
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&] (double p) -> std::int64_t {
+      if(latencies.empty()) {
+        return 0;
+      }
+      return latencies[static_cast<std::size_t>(p * (latencies.size() - 1))];
+    };
+    std::cout << "{\"benchmark\":\"" << result.m_benchmark << "\"," <<
+      "\"boundary\":\"" << ToString(result.m_boundary) << "\"," <<
+      "\"producers\":" << result.m_producers << "," <<
+      "\"consumers\":" << result.m_consumers << "," <<
+      "\"operations\":" << result.m_operations << "," <<
+      "\"seconds\":" << result.m_seconds << "," <<
+      "\"ops_per_sec\":" << (result.m_operations / result.m_seconds) << "," <<
+      "\"p50_ns\":" << percentile(0.5) << "," <<
+      "\"p99_ns\":" << percentile(0.99) << "," <<
+      "\"p999_ns\":" << percentile(0.999) << "," <<
+      "\"allocations_per_op\":" <<
+      (static_cast<double>(result.m_allocations) / result.m_operations) <<
+      "}" << std::endl;
+  }
+
+  /**
+   * Measures values handed off from producers to consumers through a shared
+   * reader, each consumer popping until it receives END_OF_STREAM. Producers
+   * push as fast as possible so latency includes time spent queued.
+   * @param name The name of the benchmark.
+   * @param boundary Where producers and consumers run.
+   * @param producerCount The number of producers.
+   * @param consumerCount The number of consumers.
+   * @param reader The reader consumers pop from.
+   * @param makeWriter Returns a callable producer <i>i</i> pushes through.
+   */
+  template<typename R, typename W>
+  void ProfileHandOff(const std::string& name, Boundary boundary,
+      int producerCount, int consumerCount, R& reader, W makeWriter) {
+    if(!IsSelected(name)) {
+      return;
+    }
+    auto countPerProducer = MESSAGE_COUNT / producerCount;
+    auto total = countPerProducer * producerCount;
+    auto log = LatencyLog(total);
+    auto remainingProducers = std::atomic_int(producerCount);
+    auto workers = Workers(boundary);
+    auto result = Result{name, boundary, producerCount, consumerCount,
+      static_cast<std::uint64_t>(total)};
+    auto stopwatch = Stopwatch();
+    for(auto i = 0; i < consumerCount; ++i) {
+      workers.SpawnConsumer([&] {
+        auto latencies = log.MakeBuffer(total);
+        while(true) {
+          auto value = reader.Pop();
+          if(value == END_OF_STREAM) {
+            break;
+          }
+          latencies.push_back(Now() - value);
+        }
+        log.Merge(latencies);
+      });
+    }
+    for(auto i = 0; i < producerCount; ++i) {
+      workers.SpawnProducer([&, i] {
+        auto push = makeWriter(i);
+        for(auto j = 0; j < countPerProducer; ++j) {
+          push(Now());
+        }
+        if(remainingProducers.fetch_sub(1) == 1) {
+          for(auto k = 0; k < consumerCount; ++k) {
+            push(END_OF_STREAM);
+          }
+        }
+      });
+    }
+    workers.Wait();
+    stopwatch.Stop(result);
+    result.m_latencies = std::move(log.GetSamples());
+    Report(result);
+  }
+
+  template<typename Q>
+  void ProfileQueue(const std::string& name, Boundary boundary,
+      int producerCount, int consumerCount) {
+    auto queue = Q();
+    ProfileHandOff(name, boundary, producerCount, consumerCount, queue,
+      [&] (int) {
+        return [&] (std::int64_t value) {
+          queue.Push(value);
+        };
+      });
+  }
+
+  void ProfileMultiQueueWriter(Boundary boundary, int producerCount) {
+    auto queue = MultiQueueWriter<std::int64_t>();
+    ProfileHandOff("MultiQueueWriter", boundary, producerCount, 1, queue,
+      [&] (int) {
+        return [writer = std::make_shared<decltype(queue.GetWriter())>(
+            queue.GetWriter())] (std::int64_t value) {
+          writer->Push(value);
+        };
+      });
+  }
+
+  /**
+   * Measures callbacks dispatched through a slot, recording the latency from
+   * the push to the invocation of the callback.
+   * @param name The name of the benchmark.
+   * @param boundary Where producers run.
+   * @param producerCount The number of producers.
+   * @param tasks The queue dispatching the callbacks.
+   * @param finish Waits for all dispatched callbacks to complete.
+   */
+  template<typename Q, typename F>
+  void ProfileSlot(const std::string& name, Boundary boundary,
+      int producerCount, Q& tasks, F finish) {
+    if(!IsSelected(name)) {
+      return;
+    }
+    auto countPerProducer = MESSAGE_COUNT / producerCount;
+    auto total = countPerProducer * producerCount;
+    auto log = LatencyLog(total);
+    auto slot = tasks.template GetSlot<std::int64_t>(
+      [&] (std::int64_t value) {
+        log.Record(Now() - value);
+      });
+    auto workers = Workers(boundary);
+    auto result = Result{name, boundary, producerCount, 1,
+      static_cast<std::uint64_t>(total)};
+    auto stopwatch = Stopwatch();
+    for(auto i = 0; i < producerCount; ++i) {
+      workers.SpawnProducer([&] {
+        for(auto j = 0; j < countPerProducer; ++j) {
+          slot.Push(Now());
+        }
+      });
+    }
+    workers.Wait();
+    finish();
+    stopwatch.Stop(result);
+    result.m_latencies = std::move(log.GetSamples());
+    Report(result);
+  }
+
+  void ProfileCallbackQueue(Boundary boundary, int producerCount) {
+    auto tasks = CallbackQueue();
+    ProfileSlot("CallbackQueue", boundary, producerCount, tasks, [] {});
+  }
+
+  void ProfileRoutineTaskQueue(Boundary boundary, int producerCount) {
+    auto tasks = RoutineTaskQueue();
+    ProfileSlot("RoutineTaskQueue", boundary, producerCount, tasks, [&] {
+      tasks.Break();
+      tasks.Wait();
+    });
+  }
+
+  /**
+   * Measures a QueueWriterPublisher fanning values out to subscribers, each
+   * drained by its own consumer.
+   * @param name The name of the benchmark.
+   * @param boundary Where the publishers and subscribers run.
+   * @param publisherCount The number of publishers.
+   * @param subscriberCount The number of subscribers.
+   * @param publishCount The total number of values published.
+   */
+  void ProfilePublisher(const std::string& name, Boundary boundary,
+      int publisherCount, int subscriberCount, int publishCount) {
+    if(!IsSelected(name)) {
+      return;
+    }
+    auto publisher = QueueWriterPublisher<std::int64_t>();
+    auto subscribers = std::vector<std::shared_ptr<Queue<std::int64_t>>>();
+    for(auto i = 0; i < subscriberCount; ++i) {
+      subscribers.push_back(std::make_shared<Queue<std::int64_t>>());
+      publisher.Monitor(subscribers.back());
+    }
+    auto countPerPublisher = publishCount / publisherCount;
+    auto total = countPerPublisher * publisherCount;
+    auto log = LatencyLog(static_cast<std::size_t>(total) * subscriberCount);
+    auto remainingPublishers = std::atomic_int(publisherCount);
+    auto workers = Workers(boundary);
+    auto result = Result{name, boundary, publisherCount, subscriberCount,
+      static_cast<std::uint64_t>(total) * subscriberCount};
+    auto stopwatch = Stopwatch();
+    for(auto& subscriber : subscribers) {
+      workers.SpawnConsumer([&, subscriber] {
+        auto latencies = log.MakeBuffer(total);
+        while(true) {
+          auto value = subscriber->Pop();
+          if(value == END_OF_STREAM) {
+            break;
+          }
+          latencies.push_back(Now() - value);
+        }
+        log.Merge(latencies);
+      });
+    }
+    for(auto i = 0; i < publisherCount; ++i) {
+      workers.SpawnProducer([&] {
+        for(auto j = 0; j < countPerPublisher; ++j) {
+          publisher.Push(Now());
+        }
+        if(remainingPublishers.fetch_sub(1) == 1) {
+          publisher.Push(END_OF_STREAM);
+        }
+      });
+    }
+    workers.Wait();
+    stopwatch.Stop(result);
+    result.m_latencies = std::move(log.GetSamples());
+    Report(result);
+  }
+
+  /**
+   * Measures the round trip of a value bounced between two queues, as used
+   * by request/response style hand-offs.
+   * @param name The name of the benchmark.
+   * @param boundary Where the requester and responder run.
+   */
+  template<typename Q>
+  void ProfileRoundTrip(const std::string& name, Boundary boundary) {
+    if(!IsSelected(name)) {
+      return;
+    }
+    auto requests = Q();
+    auto responses = Q();
+    auto log = LatencyLog(ROUND_TRIP_COUNT);
+    auto workers = Workers(boundary);
+    auto result = Result{name, boundary, 1, 1, ROUND_TRIP_COUNT};
+    auto stopwatch = Stopwatch();
+    workers.SpawnConsumer([&] {
+      for(auto i = 0; i < ROUND_TRIP_COUNT; ++i) {
+        responses.Push(requests.Pop());
+      }
+    });
+    workers.SpawnProducer([&] {
+      for(auto i = 0; i < ROUND_TRIP_COUNT; ++i) {
+        auto start = Now();
+        requests.Push(start);
+        responses.Pop();
+        log.Record(Now() - start);
+      }
+    });
+    workers.Wait();
+    stopwatch.Stop(result);
+    result.m_latencies = std::move(log.GetSamples());
+    Report(result);
+  }
+
+  void Stress() {
+    auto routines = RoutineHandlerGroup();
+    auto receiverQueue = std::make_shared<StateQueue<int>>();
+    auto senderQueue = std::make_shared<StateQueue<bool>>();
     routines.Spawn([=] {
       while(true) {
-        receiverQueue->Pop();
-        senderQueue->Push(true);
+        receiverQueue->Push(123);
+        senderQueue->Pop();
       }
     });
+    for(auto j = 0; j < 200; ++j) {
+      routines.Spawn([=] {
+        while(true) {
+          receiverQueue->Pop();
+          senderQueue->Push(true);
+        }
+      });
+    }
+  }
+}
+
+int main(int argc, const char** argv) {
+  if(argc > 1 && std::string(argv[1]) == "stress") {
+    Stress();
+    return 0;
+  }
+  if(argc > 1) {
+    g_filter = argv[1];
+  }
+  for(auto boundary : {Boundary::ROUTINE, Boundary::THREAD, Boundary::MIXED}) {
+    ProfileQueue<Queue<std::int64_t>>("Queue", boundary, 1, 1);
+    ProfileQueue<Queue<std::int64_t>>("Queue", boundary, PRODUCER_COUNT, 1);
+    ProfileQueue<Queue<std::int64_t>>(
+      "Queue", boundary, PRODUCER_COUNT, CONSUMER_COUNT);
+    ProfileQueue<SpscQueue<std::int64_t>>("SpscQueue", boundary, 1, 1);
+    ProfileQueue<MpscQueue<std::int64_t>>("MpscQueue", boundary, 1, 1);
+    ProfileQueue<MpscQueue<std::int64_t>>(
+      "MpscQueue", boundary, PRODUCER_COUNT, 1);
+    ProfileRoundTrip<Queue<std::int64_t>>("QueueRoundTrip", boundary);
+    ProfileRoundTrip<StateQueue<std::int64_t>>("StateQueueRoundTrip",
+      boundary);
+    ProfileMultiQueueWriter(boundary, PRODUCER_COUNT);
+    ProfileCallbackQueue(boundary, 1);
+    ProfileCallbackQueue(boundary, PRODUCER_COUNT);
+    ProfileRoutineTaskQueue(boundary, 1);
+    ProfileRoutineTaskQueue(boundary, PRODUCER_COUNT);
+    ProfilePublisher("QueueWriterPublisher", boundary, 1, FAN_OUT_COUNT,
+      PUBLISH_COUNT);
+    ProfilePublisher("QueueWriterPublisher", boundary, PRODUCER_COUNT,
+      FAN_OUT_COUNT, PUBLISH_COUNT);
   }
+  ProfilePublisher("QueueWriterPublisher", Boundary::ROUTINE, 1,
+    WIDE_FAN_OUT_COUNT, WIDE_PUBLISH_COUNT);
+  return 0;
 }
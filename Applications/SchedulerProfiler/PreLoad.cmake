@@ -0,0 +1,3 @@
+if(WIN32)
+  set(CMAKE_GENERATOR_PLATFORM Win32 CACHE INTERNAL "Force 32-bit.")
+endif()
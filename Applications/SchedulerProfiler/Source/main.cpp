@@ -0,0 +1,106 @@
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include "Beam/Routines/Async.hpp"
+#include "Beam/Routines/RoutineHandler.hpp"
+#include "Beam/Routines/RoutineHandlerGroup.hpp"
+#include "Version.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+namespace {
+  const auto DEFAULT_ROUTINE_COUNT = 4000000;
+  const auto DEFAULT_ASYNC_COUNT = 10000000;
+  const auto BATCH_SIZE = std::size_t(1000);
+
+  void Report(const char* name, int count,
+      std::chrono::steady_clock::time_point start) {
+    auto end = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration<double>(end - start).count();
+    std::cout << name << ": " << count << " operations, " << elapsed <<
+      "s, " << (1E9 * elapsed / count) << "ns/operation" << std::endl;
+  }
+
+  void ProfileSpawn(int routineCount) {
+    auto& scheduler = Routines::Details::Scheduler::GetInstance();
+    auto contextCount = static_cast<int>(scheduler.GetThreadCount());
+    auto routinesPerContext = routineCount / contextCount;
+    auto start = std::chrono::steady_clock::now();
+    auto drivers = RoutineHandlerGroup();
+    for(auto i = 0; i < contextCount; ++i) {
+      drivers.Add(Spawn([=] {
+        auto routines = std::vector<RoutineHandler>();
+        routines.reserve(BATCH_SIZE);
+        for(auto j = 0; j < routinesPerContext; ++j) {
+          routines.emplace_back(Spawn([] {}));
+          if(routines.size() == BATCH_SIZE) {
+            routines.clear();
+          }
+        }
+      }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE, i));
+    }
+    drivers.Wait();
+    auto end = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration<double>(end - start).count();
+    auto total = routinesPerContext * contextCount;
+    std::cout << "ProfileSpawn: " << contextCount << " contexts, " << total <<
+      " routines, " << elapsed << "s, " << (total / elapsed) <<
+      " routines/s" << std::endl;
+    auto statistics = scheduler.GetStackPool().GetStatistics();
+    std::cout << "StackPool: " << statistics.m_allocations << " allocations, " <<
+      statistics.m_hits << " hits" << std::endl;
+  }
+
+  void ProfileAsyncCompletion(int count) {
+    auto routine = RoutineHandler(Spawn([=] {
+      auto async = Async<int>();
+      auto start = std::chrono::steady_clock::now();
+      for(auto i = 0; i < count; ++i) {
+        auto eval = async.GetEval();
+        eval.SetResult(i);
+        async.Get();
+      }
+      Report("ProfileAsyncCompletion", count, start);
+    }));
+  }
+
+  void ProfileAsyncWait(int count) {
+    auto ping = Async<int>();
+    auto pong = Async<int>();
+    auto pingEval = ping.GetEval();
+    auto pongEval = pong.GetEval();
+    auto start = std::chrono::steady_clock::now();
+    auto pingRoutine = RoutineHandler(Spawn([&] {
+      for(auto i = 0; i < count; ++i) {
+        pingEval.SetResult(i);
+        pong.Get();
+        pongEval = pong.GetEval();
+      }
+    }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE, 0));
+    auto pongRoutine = RoutineHandler(Spawn([&] {
+      for(auto i = 0; i < count; ++i) {
+        ping.Get();
+        pingEval = ping.GetEval();
+        pongEval.SetResult(i);
+      }
+    }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE, 0));
+    pingRoutine.Wait();
+    pongRoutine.Wait();
+    Report("ProfileAsyncWait", count, start);
+  }
+}
+
+int main(int argc, const char** argv) {
+  std::cout << "SchedulerProfiler 1.0-r" SCHEDULER_PROFILER_VERSION <<
+    std::endl;
+  auto routineCount = DEFAULT_ROUTINE_COUNT;
+  if(argc > 1) {
+    routineCount = boost::lexical_cast<int>(argv[1]);
+  }
+  ProfileSpawn(routineCount);
+  ProfileAsyncCompletion(DEFAULT_ASYNC_COUNT);
+  ProfileAsyncWait(DEFAULT_ASYNC_COUNT / 10);
+  return 0;
+}
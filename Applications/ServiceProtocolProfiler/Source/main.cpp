@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <boost/format.hpp>
 #include "Beam/Codecs/SizeDeclarativeDecoder.hpp"
@@ -8,6 +11,7 @@
 #include "Beam/IO/LocalServerConnection.hpp"
 #include "Beam/IO/NotConnectedException.hpp"
 #include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Network/SharedMemoryServerConnection.hpp"
 #include "Beam/Network/TcpServerSocket.hpp"
 #include "Beam/Routines/RoutineHandlerGroup.hpp"
 #include "Beam/Serialization/BinaryReceiver.hpp"
@@ -33,42 +37,49 @@ using namespace boost::posix_time;
 
 namespace {
   using ServiceEncoder = SizeDeclarativeEncoder<ZLibEncoder>;
-  using ApplicationServerConnection = LocalServerConnection<SharedBuffer>;
-  using ServerChannel = ApplicationServerConnection::Channel;
-  using ApplicationServerServiceProtocolClient = ServiceProtocolClient<
-    MessageProtocol<std::unique_ptr<ServerChannel>, BinarySender<SharedBuffer>,
-    ServiceEncoder>, TriggerTimer>;
-  using ClientChannel = LocalClientChannel<SharedBuffer>;
-  using ApplicationClientServiceProtocolClient = ServiceProtocolClient<
-    MessageProtocol<ClientChannel*, BinarySender<SharedBuffer>,
+  template<typename C>
+  using ApplicationServiceProtocolClient = ServiceProtocolClient<
+    MessageProtocol<std::unique_ptr<C>, BinarySender<SharedBuffer>,
     ServiceEncoder>, TriggerTimer>;
+  const auto SHARED_MEMORY_PATH = "ServiceProtocolProfiler.sock";
 
-  std::string OnEchoRequest(ApplicationServerServiceProtocolClient& client,
+  template<typename C>
+  std::string OnEchoRequest(ApplicationServiceProtocolClient<C>& client,
       std::string message) {
     return message;
   }
 
-  void ServerLoop(ApplicationServerConnection& server) {
+  template<typename S>
+  void ServerLoop(S& server) {
+    using Channel = typename S::Channel;
     auto routines = RoutineHandlerGroup();
     while(true) {
       auto channel = server.Accept();
       routines.Spawn([channel = std::move(channel)] () mutable {
-        auto client = ApplicationServerServiceProtocolClient(std::move(channel),
-          Initialize());
+        auto client = ApplicationServiceProtocolClient<Channel>(
+          std::move(channel), Initialize());
         RegisterServiceProtocolProfilerServices(Store(client.GetSlots()));
         RegisterServiceProtocolProfilerMessages(Store(client.GetSlots()));
         EchoService::AddSlot(Store(client.GetSlots()),
-          std::bind(OnEchoRequest, std::placeholders::_1,
+          std::bind(OnEchoRequest<Channel>, std::placeholders::_1,
           std::placeholders::_2));
         try {
           auto counter = 0;
+          auto start = std::chrono::steady_clock::now();
           while(true) {
             auto message = client.ReadMessage();
             auto timestamp = microsec_clock::universal_time();
             ++counter;
             if(counter % 100000 == 0) {
-              std::cout << boost::format("Server: %1% %2%\n") % &client %
-                timestamp << std::flush;
+              auto statistics =
+                client.GetMessageProtocol().GetReaderStatistics();
+              auto elapsed = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start).count();
+              std::cout << boost::format("Server: %1% %2% messages/s: %3% "
+                "source reads/message: %4%\n") % &client % timestamp %
+                (counter / elapsed) %
+                (static_cast<double>(statistics.m_sourceReads) / counter) <<
+                std::flush;
             }
           }
         } catch(const ServiceRequestException&) {
@@ -78,9 +89,9 @@ namespace {
     }
   }
 
-  void ClientLoop(ApplicationServerConnection& server) {
-    auto channel = ClientChannel("client", server);
-    auto client = ApplicationClientServiceProtocolClient(&channel,
+  template<typename C>
+  void ClientLoop(std::unique_ptr<C> channel) {
+    auto client = ApplicationServiceProtocolClient<C>(std::move(channel),
       Initialize());
     RegisterServiceProtocolProfilerServices(Store(client.GetSlots()));
     RegisterServiceProtocolProfilerMessages(Store(client.GetSlots()));
@@ -90,14 +101,29 @@ namespace {
       SendRecordMessage<EchoMessage>(client, timestamp, "hello world");
       ++counter;
       if(counter % 100000 == 0) {
-        std::cout <<
-          boost::format("Client: %1% %2%\n") % &channel % timestamp <<
-          std::flush;
+        auto statistics = client.GetMessageProtocol().GetWriterStatistics();
+        std::cout << boost::format("Client: %1% %2% writes/flush: %3%\n") %
+          &client % timestamp % (static_cast<double>(statistics.m_writes) /
+          std::max<std::uint64_t>(statistics.m_flushes, 1)) << std::flush;
       }
       Defer();
     }
     client.Close();
   }
+
+  template<typename S, typename F>
+  void Profile(S& server, int clientCount, F channelBuilder) {
+    auto routines = RoutineHandlerGroup();
+    routines.Spawn([&] {
+      ServerLoop(server);
+    });
+    for(auto i = 0; i < clientCount; ++i) {
+      routines.Spawn([&] {
+        ClientLoop(channelBuilder());
+      });
+    }
+    routines.Wait();
+  }
 }
 
 int main(int argc, const char** argv) {
@@ -105,19 +131,33 @@ int main(int argc, const char** argv) {
     auto config = ParseCommandLine(argc, argv,
       "1.0-r" SERVICE_PROTOCOL_PROFILER_VERSION
       "\nCopyright (C) 2020 Spire Trading Inc.");
+    SetSchedulerConfig(Extract<ThreadPoolConfig>(config, "scheduler",
+      ThreadPoolConfig()));
     auto clientCount = Extract<int>(config, "clients",
       static_cast<int>(boost::thread::hardware_concurrency()));
-    auto server = ApplicationServerConnection();
-    auto routines = RoutineHandlerGroup();
-    routines.Spawn([&] {
-      ServerLoop(server);
-    });
-    for(auto i = 0; i < clientCount; ++i) {
-      routines.Spawn([&] {
-        ClientLoop(server);
+    auto transport = Extract<std::string>(config, "transport", "local");
+    if(transport == "local") {
+      auto server = LocalServerConnection<SharedBuffer>();
+      Profile(server, clientCount, [&] {
+        return std::make_unique<LocalClientChannel<SharedBuffer>>("client",
+          server);
+      });
+    } else if(transport == "tcp") {
+      auto interface = Extract<IpAddress>(GetNode(config, "server"),
+        "interface");
+      auto server = TcpServerSocket(interface);
+      Profile(server, clientCount, [&] {
+        return std::make_unique<TcpSocketChannel>(interface);
       });
+    } else if(transport == "shared_memory") {
+      auto server = SharedMemoryServerConnection(SHARED_MEMORY_PATH);
+      Profile(server, clientCount, [&] {
+        return std::make_unique<SharedMemoryChannel>(SHARED_MEMORY_PATH);
+      });
+    } else {
+      std::cerr << "Unknown transport: " << transport << std::endl;
+      return -1;
     }
-    routines.Wait();
   } catch(...) {
     ReportCurrentException();
     return -1;
@@ -1,17 +1,48 @@
 #ifndef BEAM_ASYNC_WRITER_HPP
 #define BEAM_ASYNC_WRITER_HPP
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
 #include <type_traits>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
 #include <boost/throw_exception.hpp>
+#include "Beam/IO/BufferChain.hpp"
 #include "Beam/IO/SharedBuffer.hpp"
 #include "Beam/IO/Writer.hpp"
 #include "Beam/Pointers/Dereference.hpp"
 #include "Beam/Pointers/LocalPtr.hpp"
 #include "Beam/Queues/PipeBrokenException.hpp"
 #include "Beam/Queues/RoutineTaskQueue.hpp"
+#include "Beam/Threading/TimedConditionVariable.hpp"
 
 namespace Beam {
 namespace IO {
 
+  /** Stores the options used by an AsyncWriter to coalesce writes. */
+  struct AsyncWriterOptions {
+
+    /**
+     * <code>true</code> iff writes queued while a write is in flight are
+     * gathered into a single vectored write.
+     */
+    bool m_isCoalescing;
+
+    /** The maximum number of bytes gathered into a single write. */
+    std::size_t m_maxCoalescedBytes;
+
+    /**
+     * The longest a queued write is held back waiting for further writes to
+     * gather with it.
+     */
+    boost::posix_time::time_duration m_maxCoalescingDelay;
+
+    /** Constructs the default options, with coalescing disabled. */
+    AsyncWriterOptions();
+  };
+
   /**
    * Asynchronously writes to a destination using a Routine.
    * @param <W> The Writer to write to.
@@ -24,6 +55,19 @@ namespace IO {
       /** The destination to write to. */
       using DestinationWriter = GetTryDereferenceType<W>;
 
+      /** Stores counters used to measure how effectively writes coalesce. */
+      struct Statistics {
+
+        /** The number of writes made to this AsyncWriter. */
+        std::uint64_t m_writes;
+
+        /** The number of writes issued to the destination. */
+        std::uint64_t m_flushes;
+
+        /** The number of bytes written. */
+        std::uint64_t m_bytes;
+      };
+
       /**
        * Constructs an AsyncWriter.
        * @param destination Used to initialize the destination of all writes.
@@ -31,24 +75,89 @@ namespace IO {
       template<typename WF>
       AsyncWriter(WF&& destination);
 
+      /**
+       * Constructs an AsyncWriter.
+       * @param destination Used to initialize the destination of all writes.
+       * @param options The options used to coalesce writes.
+       */
+      template<typename WF>
+      AsyncWriter(WF&& destination, const AsyncWriterOptions& options);
+
+      /**
+       * Returns the Statistics, the ratio of writes to flushes being the
+       * average number of writes coalesced into each destination write.
+       */
+      Statistics GetStatistics() const;
+
       void Write(const void* data, std::size_t size);
 
+      /**
+       * Writes a Buffer or a BufferChain, a BufferChain being forwarded to
+       * the destination without flattening it when the destination supports
+       * vectored writes.
+       * @param data The data to write.
+       */
       template<typename B>
       void Write(const B& data);
 
     private:
+      struct PendingChain {
+        BufferChain m_chain;
+        std::chrono::steady_clock::time_point m_timestamp;
+      };
       GetOptionalLocalPtr<W> m_destination;
+      AsyncWriterOptions m_options;
+      std::atomic<std::uint64_t> m_writes;
+      std::atomic<std::uint64_t> m_flushes;
+      std::atomic<std::uint64_t> m_bytes;
+      boost::mutex m_mutex;
+      std::deque<PendingChain> m_pending;
+      bool m_isFlushing;
+      Threading::TimedConditionVariable m_coalescingCondition;
       std::exception_ptr m_exception;
       RoutineTaskQueue m_tasks;
+
+      template<typename B>
+      void Coalesce(const B& data);
+      void Flush();
+      void Fail();
   };
 
+  inline AsyncWriterOptions::AsyncWriterOptions()
+    : m_isCoalescing(false),
+      m_maxCoalescedBytes(64 * 1024),
+      m_maxCoalescingDelay(boost::posix_time::seconds(0)) {}
+
   template<typename W>
   AsyncWriter(W&&) -> AsyncWriter<std::decay_t<W>>;
 
+  template<typename W>
+  AsyncWriter(W&&, const AsyncWriterOptions&) -> AsyncWriter<std::decay_t<W>>;
+
   template<typename W>
   template<typename WF>
   AsyncWriter<W>::AsyncWriter(WF&& destination)
-    : m_destination(std::forward<WF>(destination)) {}
+    : AsyncWriter(std::forward<WF>(destination), AsyncWriterOptions()) {}
+
+  template<typename W>
+  template<typename WF>
+  AsyncWriter<W>::AsyncWriter(WF&& destination,
+    const AsyncWriterOptions& options)
+    : m_destination(std::forward<WF>(destination)),
+      m_options(options),
+      m_writes(0),
+      m_flushes(0),
+      m_bytes(0),
+      m_isFlushing(false) {}
+
+  template<typename W>
+  typename AsyncWriter<W>::Statistics AsyncWriter<W>::GetStatistics() const {
+    auto statistics = Statistics();
+    statistics.m_writes = m_writes.load(std::memory_order_relaxed);
+    statistics.m_flushes = m_flushes.load(std::memory_order_relaxed);
+    statistics.m_bytes = m_bytes.load(std::memory_order_relaxed);
+    return statistics;
+  }
 
   template<typename W>
   void AsyncWriter<W>::Write(const void* data, std::size_t size) {
@@ -58,15 +167,24 @@ namespace IO {
   template<typename W>
   template<typename B>
   void AsyncWriter<W>::Write(const B& data) {
+    m_writes.fetch_add(1, std::memory_order_relaxed);
+    m_bytes.fetch_add(data.GetSize(), std::memory_order_relaxed);
+    if(m_options.m_isCoalescing) {
+      Coalesce(data);
+      return;
+    }
     try {
       m_tasks.Push([=] {
         try {
-          m_destination->Write(data);
+          m_flushes.fetch_add(1, std::memory_order_relaxed);
+          if constexpr(std::is_same_v<B, BufferChain>) {
+            WriteChain(*m_destination, data);
+          } else {
+            m_destination->Write(data);
+          }
         } catch(const std::exception&) {
           if(!m_exception) {
-            m_exception = std::current_exception();
-            m_tasks.Break();
-            BOOST_THROW_EXCEPTION(PipeBrokenException());
+            Fail();
           }
         }
       });
@@ -74,8 +192,99 @@ namespace IO {
       std::rethrow_exception(m_exception);
     }
   }
+
+  template<typename W>
+  template<typename B>
+  void AsyncWriter<W>::Coalesce(const B& data) {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_exception) {
+      std::rethrow_exception(m_exception);
+    }
+    auto isNewChain = m_pending.empty() || m_pending.back().m_chain.GetSize() +
+      data.GetSize() > m_options.m_maxCoalescedBytes;
+    if(isNewChain) {
+      m_pending.push_back({BufferChain(), std::chrono::steady_clock::now()});
+    }
+    auto& chain = m_pending.back().m_chain;
+    if constexpr(std::is_same_v<B, BufferChain>) {
+      for(auto& segment : data.GetSegments()) {
+        chain.Append(segment);
+      }
+    } else if constexpr(std::is_same_v<B, SharedBuffer>) {
+      chain.Append(data);
+    } else {
+      chain.Append(data.GetData(), data.GetSize());
+    }
+    if(m_isFlushing) {
+      if((isNewChain && m_pending.size() == 2) || (m_pending.size() == 1 &&
+          chain.GetSize() >= m_options.m_maxCoalescedBytes)) {
+        m_coalescingCondition.notify_one();
+      }
+      return;
+    }
+    m_isFlushing = true;
+    try {
+      m_tasks.Push([=] {
+        Flush();
+      });
+    } catch(const PipeBrokenException&) {
+      m_isFlushing = false;
+      m_pending.clear();
+      std::rethrow_exception(m_exception);
+    }
+  }
+
+  template<typename W>
+  void AsyncWriter<W>::Flush() {
+    auto maxDelay = std::chrono::microseconds(
+      m_options.m_maxCoalescingDelay.total_microseconds());
+    while(true) {
+      auto chain = BufferChain();
+      {
+        auto lock = boost::unique_lock(m_mutex);
+        while(maxDelay.count() > 0 && m_pending.size() == 1 &&
+            m_pending.front().m_chain.GetSize() <
+              m_options.m_maxCoalescedBytes) {
+          auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - m_pending.front().m_timestamp);
+          if(elapsed >= maxDelay) {
+            break;
+          }
+          try {
+            m_coalescingCondition.timed_wait(boost::posix_time::microseconds(
+              (maxDelay - elapsed).count()), lock);
+          } catch(const Threading::TimeoutException&) {}
+        }
+        if(m_pending.empty()) {
+          m_isFlushing = false;
+          return;
+        }
+        chain = std::move(m_pending.front().m_chain);
+        m_pending.pop_front();
+      }
+      try {
+        m_flushes.fetch_add(1, std::memory_order_relaxed);
+        WriteChain(*m_destination, chain);
+      } catch(const std::exception&) {
+        auto lock = boost::lock_guard(m_mutex);
+        m_pending.clear();
+        m_isFlushing = false;
+        Fail();
+      }
+    }
+  }
+
+  template<typename W>
+  void AsyncWriter<W>::Fail() {
+    m_exception = std::current_exception();
+    m_tasks.Break();
+    BOOST_THROW_EXCEPTION(PipeBrokenException());
+  }
 }
 
+  template<typename W>
+  struct IO::VectoredWriteSupport<IO::AsyncWriter<W>> : std::true_type {};
+
   template<typename BufferType, typename W>
   struct ImplementsConcept<IO::AsyncWriter<W>, IO::Writer<BufferType>> :
     std::true_type {};
@@ -0,0 +1,166 @@
+#ifndef BEAM_BUFFER_CHAIN_HPP
+#define BEAM_BUFFER_CHAIN_HPP
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include <boost/container/small_vector.hpp>
+#include "Beam/IO/IO.hpp"
+#include "Beam/IO/SharedBuffer.hpp"
+
+namespace Beam::IO {
+
+  /**
+   * Stores a sequence of SharedBuffers that are written as a single
+   * contiguous unit, allowing a message to be assembled out of separately
+   * produced segments without copying them into one Buffer.
+   */
+  class BufferChain {
+    public:
+
+      /** The number of segments stored without allocating. */
+      static constexpr auto INLINE_SEGMENTS = std::size_t(4);
+
+      /** The type used to store the segments. */
+      using Segments =
+        boost::container::small_vector<SharedBuffer, INLINE_SEGMENTS>;
+
+      /** Constructs an empty BufferChain. */
+      BufferChain();
+
+      /**
+       * Constructs a BufferChain from a list of segments.
+       * @param segments The segments to append, in order.
+       */
+      BufferChain(std::initializer_list<SharedBuffer> segments);
+
+      /** Returns <code>true</code> iff the chain contains no data. */
+      bool IsEmpty() const;
+
+      /** Returns the total size of all segments. */
+      std::size_t GetSize() const;
+
+      /** Returns the segments in the order they are written. */
+      const Segments& GetSegments() const;
+
+      /**
+       * Appends a segment to the end of the chain, sharing its data.
+       * @param segment The segment to append.
+       */
+      void Append(SharedBuffer segment);
+
+      /**
+       * Appends a copy of raw data as a new segment.
+       * @param data The data to append.
+       * @param size The size of the data.
+       */
+      void Append(const void* data, std::size_t size);
+
+      /**
+       * Prepends a segment to the front of the chain, sharing its data.
+       * @param segment The segment to prepend.
+       */
+      void Prepend(SharedBuffer segment);
+
+      /** Removes all segments. */
+      void Reset();
+
+      /**
+       * Returns the chain as a single SharedBuffer. A chain with only one
+       * segment returns it without copying.
+       */
+      SharedBuffer Flatten() const;
+
+    private:
+      std::size_t m_size;
+      Segments m_segments;
+  };
+
+  /**
+   * Specifies whether a Writer implements <code>Write(const BufferChain&)
+   * </code>, writing the chain as a single unit without flattening it.
+   * @param <W> The Writer to test.
+   */
+  template<typename W>
+  struct VectoredWriteSupport : std::false_type {};
+
+  /**
+   * Writes a BufferChain to a Writer, using the Writer's own BufferChain
+   * overload when it has one and otherwise writing the flattened chain.
+   * @param writer The Writer to write to.
+   * @param chain The BufferChain to write.
+   */
+  template<typename W>
+  void WriteChain(W& writer, const BufferChain& chain) {
+    if constexpr(VectoredWriteSupport<W>::value) {
+      writer.Write(chain);
+    } else if constexpr(std::is_same_v<typename W::Buffer, SharedBuffer>) {
+      writer.Write(chain.Flatten());
+    } else {
+      auto buffer = chain.Flatten();
+      writer.Write(buffer.GetData(), buffer.GetSize());
+    }
+  }
+
+  inline BufferChain::BufferChain()
+    : m_size(0) {}
+
+  inline BufferChain::BufferChain(std::initializer_list<SharedBuffer> segments)
+      : BufferChain() {
+    for(auto& segment : segments) {
+      Append(segment);
+    }
+  }
+
+  inline bool BufferChain::IsEmpty() const {
+    return m_size == 0;
+  }
+
+  inline std::size_t BufferChain::GetSize() const {
+    return m_size;
+  }
+
+  inline const BufferChain::Segments& BufferChain::GetSegments() const {
+    return m_segments;
+  }
+
+  inline void BufferChain::Append(SharedBuffer segment) {
+    if(segment.IsEmpty()) {
+      return;
+    }
+    m_size += segment.GetSize();
+    m_segments.push_back(std::move(segment));
+  }
+
+  inline void BufferChain::Append(const void* data, std::size_t size) {
+    Append(SharedBuffer(data, size));
+  }
+
+  inline void BufferChain::Prepend(SharedBuffer segment) {
+    if(segment.IsEmpty()) {
+      return;
+    }
+    m_size += segment.GetSize();
+    m_segments.insert(m_segments.begin(), std::move(segment));
+  }
+
+  inline void BufferChain::Reset() {
+    m_size = 0;
+    m_segments.clear();
+  }
+
+  inline SharedBuffer BufferChain::Flatten() const {
+    if(m_segments.size() == 1) {
+      return m_segments.front();
+    }
+    auto buffer = SharedBuffer();
+    buffer.Reserve(m_size);
+    buffer.Reset();
+    for(auto& segment : m_segments) {
+      buffer.Append(segment);
+    }
+    return buffer;
+  }
+}
+
+#endif
@@ -0,0 +1,422 @@
+#ifndef BEAM_BUFFER_POOL_HPP
+#define BEAM_BUFFER_POOL_HPP
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <vector>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/throw_exception.hpp>
+#include "Beam/IO/IO.hpp"
+
+#ifndef BEAM_BUFFER_POOL_DEFAULT_RETENTION
+  #define BEAM_BUFFER_POOL_DEFAULT_RETENTION 67108864
+#endif
+
+#ifndef BEAM_BUFFER_POOL_THREAD_CACHE_SIZE
+  #define BEAM_BUFFER_POOL_THREAD_CACHE_SIZE 262144
+#endif
+
+namespace Beam::IO {
+
+  /**
+   * Caches memory blocks grouped by power of two size classes so that buffers
+   * can be allocated without going through the heap. Each thread keeps a
+   * small cache of its own, exchanging blocks in batches with a shared pool.
+   */
+  class BufferPool {
+    public:
+
+      /** The smallest block handed out. */
+      static constexpr std::size_t MIN_BLOCK_SIZE = 64;
+
+      /** The largest block retained, larger blocks bypass the pool. */
+      static constexpr std::size_t MAX_BLOCK_SIZE = std::size_t(1) << 20;
+
+      /** The default number of bytes retained by the shared pool. */
+      static constexpr std::size_t DEFAULT_RETENTION =
+        BEAM_BUFFER_POOL_DEFAULT_RETENTION;
+
+      /** The number of bytes of each size class a thread caches. */
+      static constexpr std::size_t THREAD_CACHE_SIZE =
+        BEAM_BUFFER_POOL_THREAD_CACHE_SIZE;
+
+      /** Stores a snapshot of a BufferPool's counters. */
+      struct Statistics {
+
+        /** The number of blocks requested from the pool. */
+        std::uint64_t m_allocations;
+
+        /** The number of requests served by reusing a retained block. */
+        std::uint64_t m_hits;
+
+        /** The number of blocks released because the pool was full. */
+        std::uint64_t m_evictions;
+
+        /** The number of bytes handed out and not yet returned. */
+        std::int64_t m_outstandingBytes;
+
+        /** The number of bytes retained by the pool and thread caches. */
+        std::int64_t m_retainedBytes;
+      };
+
+      /**
+       * Returns the BufferPool shared by the process. The instance is never
+       * destroyed so that buffers outliving static destruction can still be
+       * returned to it.
+       */
+      static BufferPool& GetInstance();
+
+      /**
+       * Returns the size of the block used to store a given number of bytes.
+       * @param size The minimum number of bytes needed.
+       */
+      static std::size_t GetBlockSize(std::size_t size);
+
+      /** Returns the maximum number of bytes the shared pool retains. */
+      std::size_t GetRetention() const;
+
+      /**
+       * Sets the maximum number of bytes the shared pool retains.
+       * @param retention The maximum number of bytes to retain.
+       */
+      void SetRetention(std::size_t retention);
+
+      /** Returns a snapshot of this pool's counters. */
+      Statistics GetStatistics() const;
+
+      /**
+       * Allocates a block.
+       * @param blockSize The size of the block, as returned by GetBlockSize.
+       * @return The allocated block.
+       */
+      void* Allocate(std::size_t blockSize);
+
+      /**
+       * Returns a block to the pool.
+       * @param block The block to return.
+       * @param blockSize The size the block was allocated with.
+       */
+      void Deallocate(void* block, std::size_t blockSize);
+
+      /** Releases all blocks retained by the shared pool. */
+      void Clear();
+
+    private:
+      static constexpr auto SIZE_CLASS_COUNT = std::size_t(15);
+      struct SizeClass {
+        boost::mutex m_mutex;
+        std::vector<void*> m_blocks;
+      };
+      struct Counters {
+        std::atomic_uint64_t m_allocations;
+        std::atomic_uint64_t m_hits;
+        std::atomic_uint64_t m_evictions;
+        std::atomic_int64_t m_outstandingBytes;
+        std::atomic_int64_t m_retainedBytes;
+
+        Counters();
+      };
+      struct ThreadCache {
+        std::array<std::vector<void*>, SIZE_CLASS_COUNT> m_blocks;
+        Counters m_counters;
+      };
+      struct ThreadCacheGuard {
+        ~ThreadCacheGuard();
+      };
+      std::atomic_size_t m_retention;
+      std::array<SizeClass, SIZE_CLASS_COUNT> m_sizeClasses;
+      Counters m_counters;
+      mutable boost::mutex m_cachesMutex;
+      std::vector<ThreadCache*> m_caches;
+
+      BufferPool();
+      BufferPool(const BufferPool&) = delete;
+      BufferPool& operator =(const BufferPool&) = delete;
+      static std::size_t GetSizeClass(std::size_t blockSize);
+      static std::size_t GetThreadCacheCount(std::size_t sizeClass);
+      static void Add(std::atomic_uint64_t& counter, std::uint64_t value);
+      static void Add(std::atomic_int64_t& counter, std::int64_t value);
+      template<typename T, typename U>
+      static void AddLocal(std::atomic<T>& counter, U value);
+      static ThreadCache*& GetThreadCacheSlot();
+      static bool& IsThreadCacheReleased();
+      ThreadCache* GetThreadCache();
+      void ReleaseThreadCache(ThreadCache& cache);
+      bool Acquire(std::size_t sizeClass, std::vector<void*>& blocks,
+        std::size_t count, Counters& counters);
+      void Retain(std::size_t sizeClass, std::vector<void*>& blocks,
+        std::size_t count, Counters& counters);
+  };
+
+  inline BufferPool::Counters::Counters()
+    : m_allocations(0),
+      m_hits(0),
+      m_evictions(0),
+      m_outstandingBytes(0),
+      m_retainedBytes(0) {}
+
+  inline BufferPool::ThreadCacheGuard::~ThreadCacheGuard() {
+    if(auto& cache = GetThreadCacheSlot()) {
+      GetInstance().ReleaseThreadCache(*cache);
+      cache = nullptr;
+    }
+    IsThreadCacheReleased() = true;
+  }
+
+  inline BufferPool& BufferPool::GetInstance() {
+    static auto pool = new BufferPool();
+    return *pool;
+  }
+
+  inline std::size_t BufferPool::GetBlockSize(std::size_t size) {
+    auto blockSize = MIN_BLOCK_SIZE;
+    while(blockSize < size) {
+      if(blockSize > std::numeric_limits<std::size_t>::max() / 2) {
+        BOOST_THROW_EXCEPTION(std::bad_alloc());
+      }
+      blockSize *= 2;
+    }
+    return blockSize;
+  }
+
+  inline std::size_t BufferPool::GetRetention() const {
+    return m_retention;
+  }
+
+  inline void BufferPool::SetRetention(std::size_t retention) {
+    m_retention = retention;
+  }
+
+  inline BufferPool::Statistics BufferPool::GetStatistics() const {
+    auto statistics = Statistics();
+    auto add = [&] (const Counters& counters) {
+      statistics.m_allocations += counters.m_allocations.load(
+        std::memory_order_relaxed);
+      statistics.m_hits += counters.m_hits.load(std::memory_order_relaxed);
+      statistics.m_evictions += counters.m_evictions.load(
+        std::memory_order_relaxed);
+      statistics.m_outstandingBytes += counters.m_outstandingBytes.load(
+        std::memory_order_relaxed);
+      statistics.m_retainedBytes += counters.m_retainedBytes.load(
+        std::memory_order_relaxed);
+    };
+    auto lock = boost::lock_guard(m_cachesMutex);
+    add(m_counters);
+    for(auto cache : m_caches) {
+      add(cache->m_counters);
+    }
+    return statistics;
+  }
+
+  inline void* BufferPool::Allocate(std::size_t blockSize) {
+    auto cache = GetThreadCache();
+    if(!cache) {
+      Add(m_counters.m_allocations, 1);
+      Add(m_counters.m_outstandingBytes, static_cast<std::int64_t>(blockSize));
+      auto blocks = std::vector<void*>();
+      if(blockSize > MAX_BLOCK_SIZE ||
+          !Acquire(GetSizeClass(blockSize), blocks, 1, m_counters)) {
+        return ::operator new(blockSize);
+      }
+      Add(m_counters.m_hits, 1);
+      Add(m_counters.m_retainedBytes, -static_cast<std::int64_t>(blockSize));
+      return blocks.back();
+    }
+    auto& counters = cache->m_counters;
+    AddLocal(counters.m_allocations, 1);
+    AddLocal(counters.m_outstandingBytes, blockSize);
+    if(blockSize > MAX_BLOCK_SIZE) {
+      return ::operator new(blockSize);
+    }
+    auto sizeClass = GetSizeClass(blockSize);
+    auto& blocks = cache->m_blocks[sizeClass];
+    if(blocks.empty() && !Acquire(sizeClass, blocks,
+        std::max<std::size_t>(GetThreadCacheCount(sizeClass) / 2, 1),
+        counters)) {
+      return ::operator new(blockSize);
+    }
+    auto block = blocks.back();
+    blocks.pop_back();
+    AddLocal(counters.m_hits, 1);
+    AddLocal(counters.m_retainedBytes, -static_cast<std::int64_t>(blockSize));
+    return block;
+  }
+
+  inline void BufferPool::Deallocate(void* block, std::size_t blockSize) {
+    auto cache = GetThreadCache();
+    if(!cache) {
+      Add(m_counters.m_outstandingBytes,
+        -static_cast<std::int64_t>(blockSize));
+      if(blockSize > MAX_BLOCK_SIZE) {
+        ::operator delete(block);
+        return;
+      }
+      auto blocks = std::vector<void*>{block};
+      Add(m_counters.m_retainedBytes, static_cast<std::int64_t>(blockSize));
+      Retain(GetSizeClass(blockSize), blocks, 1, m_counters);
+      return;
+    }
+    auto& counters = cache->m_counters;
+    AddLocal(counters.m_outstandingBytes,
+      -static_cast<std::int64_t>(blockSize));
+    if(blockSize > MAX_BLOCK_SIZE) {
+      ::operator delete(block);
+      return;
+    }
+    auto sizeClass = GetSizeClass(blockSize);
+    auto& blocks = cache->m_blocks[sizeClass];
+    auto capacity = GetThreadCacheCount(sizeClass);
+    if(blocks.size() >= capacity) {
+      Retain(sizeClass, blocks, std::max<std::size_t>(capacity / 2, 1),
+        counters);
+    }
+    if(blocks.capacity() == 0) {
+      blocks.reserve(capacity);
+    }
+    blocks.push_back(block);
+    AddLocal(counters.m_retainedBytes, blockSize);
+  }
+
+  inline void BufferPool::Clear() {
+    if(auto cache = GetThreadCache()) {
+      for(auto i = std::size_t(0); i != SIZE_CLASS_COUNT; ++i) {
+        Retain(i, cache->m_blocks[i], cache->m_blocks[i].size(),
+          cache->m_counters);
+      }
+    }
+    for(auto i = std::size_t(0); i != SIZE_CLASS_COUNT; ++i) {
+      auto blocks = std::vector<void*>();
+      {
+        auto lock = boost::lock_guard(m_sizeClasses[i].m_mutex);
+        blocks.swap(m_sizeClasses[i].m_blocks);
+      }
+      Add(m_counters.m_retainedBytes, -static_cast<std::int64_t>(
+        blocks.size() * (MIN_BLOCK_SIZE << i)));
+      for(auto block : blocks) {
+        ::operator delete(block);
+      }
+    }
+  }
+
+  inline BufferPool::BufferPool()
+    : m_retention(DEFAULT_RETENTION) {}
+
+  inline std::size_t BufferPool::GetSizeClass(std::size_t blockSize) {
+    auto sizeClass = std::size_t(0);
+    while((MIN_BLOCK_SIZE << sizeClass) < blockSize) {
+      ++sizeClass;
+    }
+    return sizeClass;
+  }
+
+  inline std::size_t BufferPool::GetThreadCacheCount(std::size_t sizeClass) {
+    return std::max<std::size_t>(
+      THREAD_CACHE_SIZE / (MIN_BLOCK_SIZE << sizeClass), 2);
+  }
+
+  inline void BufferPool::Add(std::atomic_uint64_t& counter,
+      std::uint64_t value) {
+    counter.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  inline void BufferPool::Add(std::atomic_int64_t& counter,
+      std::int64_t value) {
+    counter.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  template<typename T, typename U>
+  void BufferPool::AddLocal(std::atomic<T>& counter, U value) {
+    counter.store(static_cast<T>(
+      counter.load(std::memory_order_relaxed) + value),
+      std::memory_order_relaxed);
+  }
+
+  inline BufferPool::ThreadCache*& BufferPool::GetThreadCacheSlot() {
+    static thread_local auto cache = static_cast<ThreadCache*>(nullptr);
+    return cache;
+  }
+
+  inline bool& BufferPool::IsThreadCacheReleased() {
+    static thread_local auto isReleased = false;
+    return isReleased;
+  }
+
+  inline BufferPool::ThreadCache* BufferPool::GetThreadCache() {
+    auto& cache = GetThreadCacheSlot();
+    if(cache || IsThreadCacheReleased()) {
+      return cache;
+    }
+    static thread_local auto guard = ThreadCacheGuard();
+    cache = new ThreadCache();
+    auto lock = boost::lock_guard(m_cachesMutex);
+    m_caches.push_back(cache);
+    return cache;
+  }
+
+  inline void BufferPool::ReleaseThreadCache(ThreadCache& cache) {
+    for(auto i = std::size_t(0); i != SIZE_CLASS_COUNT; ++i) {
+      Retain(i, cache.m_blocks[i], cache.m_blocks[i].size(),
+        cache.m_counters);
+    }
+    auto lock = boost::lock_guard(m_cachesMutex);
+    m_caches.erase(std::find(m_caches.begin(), m_caches.end(), &cache));
+    Add(m_counters.m_allocations, cache.m_counters.m_allocations);
+    Add(m_counters.m_hits, cache.m_counters.m_hits);
+    Add(m_counters.m_evictions, cache.m_counters.m_evictions);
+    Add(m_counters.m_outstandingBytes, cache.m_counters.m_outstandingBytes);
+    Add(m_counters.m_retainedBytes, cache.m_counters.m_retainedBytes);
+    delete &cache;
+  }
+
+  inline bool BufferPool::Acquire(std::size_t sizeClass,
+      std::vector<void*>& blocks, std::size_t count, Counters& counters) {
+    auto& pool = m_sizeClasses[sizeClass];
+    auto lock = boost::lock_guard(pool.m_mutex);
+    if(pool.m_blocks.empty()) {
+      return false;
+    }
+    count = std::min(count, pool.m_blocks.size());
+    blocks.insert(blocks.end(), pool.m_blocks.end() - count,
+      pool.m_blocks.end());
+    pool.m_blocks.erase(pool.m_blocks.end() - count, pool.m_blocks.end());
+    auto size =
+      static_cast<std::int64_t>(count * (MIN_BLOCK_SIZE << sizeClass));
+    Add(m_counters.m_retainedBytes, -size);
+    Add(counters.m_retainedBytes, size);
+    return true;
+  }
+
+  inline void BufferPool::Retain(std::size_t sizeClass,
+      std::vector<void*>& blocks, std::size_t count, Counters& counters) {
+    auto blockSize = MIN_BLOCK_SIZE << sizeClass;
+    auto size = static_cast<std::int64_t>(count * blockSize);
+    Add(counters.m_retainedBytes, -size);
+    auto evicted = std::vector<void*>();
+    {
+      auto& pool = m_sizeClasses[sizeClass];
+      auto lock = boost::lock_guard(pool.m_mutex);
+      auto retention = static_cast<std::int64_t>(m_retention.load());
+      for(auto i = blocks.size() - count; i != blocks.size(); ++i) {
+        if(m_counters.m_retainedBytes.load(std::memory_order_relaxed) +
+            static_cast<std::int64_t>(blockSize) > retention) {
+          evicted.push_back(blocks[i]);
+        } else {
+          pool.m_blocks.push_back(blocks[i]);
+          Add(m_counters.m_retainedBytes,
+            static_cast<std::int64_t>(blockSize));
+        }
+      }
+    }
+    blocks.erase(blocks.end() - count, blocks.end());
+    Add(counters.m_evictions, evicted.size());
+    for(auto block : evicted) {
+      ::operator delete(block);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,256 @@
+#ifndef BEAM_BUFFERED_READER_HPP
+#define BEAM_BUFFERED_READER_HPP
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include "Beam/IO/IO.hpp"
+#include "Beam/IO/IOException.hpp"
+#include "Beam/IO/Reader.hpp"
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Pointers/Dereference.hpp"
+#include "Beam/Pointers/LocalPtr.hpp"
+
+namespace Beam {
+namespace IO {
+
+  /**
+   * Reads ahead from a source Reader into an internal buffer so that many
+   * small reads are served from a single read of the source. The amount read
+   * ahead grows with the size of the reads being made and decays back once
+   * reads become small again.
+   * @param <R> The type of Reader to read from.
+   */
+  template<typename R>
+  class BufferedReader {
+    public:
+
+      /** The source to read from. */
+      using SourceReader = GetTryDereferenceType<R>;
+
+      /** The default minimum number of bytes to read ahead. */
+      static constexpr auto DEFAULT_MIN_READ_AHEAD = std::size_t(8 * 1024);
+
+      /** The default maximum number of bytes to read ahead. */
+      static constexpr auto DEFAULT_MAX_READ_AHEAD =
+        std::size_t(1024 * 1024);
+
+      /** Stores counters measuring how many source reads were saved. */
+      struct Statistics {
+
+        /** The number of reads made to this BufferedReader. */
+        std::uint64_t m_reads;
+
+        /** The number of reads made to the source. */
+        std::uint64_t m_sourceReads;
+
+        /** The current number of bytes read ahead. */
+        std::size_t m_readAheadSize;
+      };
+
+      /**
+       * Constructs a BufferedReader.
+       * @param source Used to initialize the Reader to read from.
+       */
+      template<typename RF>
+      BufferedReader(RF&& source);
+
+      /**
+       * Constructs a BufferedReader.
+       * @param source Used to initialize the Reader to read from.
+       * @param minReadAheadSize The minimum number of bytes to read ahead.
+       * @param maxReadAheadSize The maximum number of bytes to read ahead,
+       *        reads at least this large go directly to the source.
+       */
+      template<typename RF>
+      BufferedReader(RF&& source, std::size_t minReadAheadSize,
+        std::size_t maxReadAheadSize);
+
+      /** Returns the Statistics. */
+      Statistics GetStatistics() const;
+
+      bool IsDataAvailable() const;
+
+      template<typename Buffer>
+      std::size_t Read(Out<Buffer> destination);
+
+      std::size_t Read(char* destination, std::size_t size);
+
+      template<typename Buffer>
+      std::size_t Read(Out<Buffer> destination, std::size_t size);
+
+    private:
+      static constexpr auto DECAY_COUNT = 1024;
+      GetOptionalLocalPtr<R> m_source;
+      std::size_t m_minReadAheadSize;
+      std::size_t m_maxReadAheadSize;
+      std::size_t m_readAheadSize;
+      int m_smallReadCount;
+      SharedBuffer m_buffer;
+      std::size_t m_position;
+      std::atomic<std::uint64_t> m_reads;
+      std::atomic<std::uint64_t> m_sourceReads;
+
+      BufferedReader(const BufferedReader&) = delete;
+      BufferedReader& operator =(const BufferedReader&) = delete;
+      std::size_t GetAvailableSize() const;
+      void Observe(std::size_t size);
+      void Increment(std::atomic<std::uint64_t>& counter);
+      void Fill();
+  };
+
+  template<typename R>
+  BufferedReader(R&&) -> BufferedReader<std::decay_t<R>>;
+
+  template<typename R>
+  template<typename RF>
+  BufferedReader<R>::BufferedReader(RF&& source)
+    : BufferedReader(std::forward<RF>(source), DEFAULT_MIN_READ_AHEAD,
+        DEFAULT_MAX_READ_AHEAD) {}
+
+  template<typename R>
+  template<typename RF>
+  BufferedReader<R>::BufferedReader(RF&& source, std::size_t minReadAheadSize,
+    std::size_t maxReadAheadSize)
+    : m_source(std::forward<RF>(source)),
+      m_minReadAheadSize(std::max<std::size_t>(minReadAheadSize, 1)),
+      m_maxReadAheadSize(std::max(maxReadAheadSize, m_minReadAheadSize)),
+      m_readAheadSize(m_minReadAheadSize),
+      m_smallReadCount(0),
+      m_position(0),
+      m_reads(0),
+      m_sourceReads(0) {}
+
+  template<typename R>
+  typename BufferedReader<R>::Statistics
+      BufferedReader<R>::GetStatistics() const {
+    auto statistics = Statistics();
+    statistics.m_reads = m_reads.load(std::memory_order_relaxed);
+    statistics.m_sourceReads = m_sourceReads.load(std::memory_order_relaxed);
+    statistics.m_readAheadSize = m_readAheadSize;
+    return statistics;
+  }
+
+  template<typename R>
+  bool BufferedReader<R>::IsDataAvailable() const {
+    return GetAvailableSize() != 0 || m_source->IsDataAvailable();
+  }
+
+  template<typename R>
+  template<typename Buffer>
+  std::size_t BufferedReader<R>::Read(Out<Buffer> destination) {
+    Increment(m_reads);
+    if(GetAvailableSize() == 0) {
+      Fill();
+    }
+    auto size = GetAvailableSize();
+    try {
+      destination->Append(m_buffer.GetData() + m_position, size);
+    } catch(const std::exception&) {
+      std::throw_with_nested(IOException());
+    }
+    m_position += size;
+    return size;
+  }
+
+  template<typename R>
+  std::size_t BufferedReader<R>::Read(char* destination, std::size_t size) {
+    if(size == 0) {
+      return 0;
+    }
+    Increment(m_reads);
+    Observe(size);
+    if(GetAvailableSize() == 0) {
+      if(size >= m_maxReadAheadSize) {
+        Increment(m_sourceReads);
+        return m_source->Read(destination, size);
+      }
+      Fill();
+    }
+    auto readSize = std::min(size, GetAvailableSize());
+    std::memcpy(destination, m_buffer.GetData() + m_position, readSize);
+    m_position += readSize;
+    return readSize;
+  }
+
+  template<typename R>
+  template<typename Buffer>
+  std::size_t BufferedReader<R>::Read(Out<Buffer> destination,
+      std::size_t size) {
+    if(size == std::numeric_limits<std::size_t>::max()) {
+      return Read(Store(destination));
+    }
+    auto initialSize = destination->GetSize();
+    try {
+      destination->Grow(size);
+    } catch(const std::exception&) {
+      std::throw_with_nested(IOException());
+    }
+    auto readSize = std::size_t(0);
+    try {
+      readSize = Read(destination->GetMutableData() + initialSize, size);
+    } catch(const std::exception&) {
+      destination->Shrink(size);
+      throw;
+    }
+    destination->Shrink(size - readSize);
+    return readSize;
+  }
+
+  template<typename R>
+  std::size_t BufferedReader<R>::GetAvailableSize() const {
+    return m_buffer.GetSize() - m_position;
+  }
+
+  template<typename R>
+  void BufferedReader<R>::Observe(std::size_t size) {
+    if(size > m_readAheadSize / 2 && m_readAheadSize < m_maxReadAheadSize) {
+      while(m_readAheadSize < 2 * size &&
+          m_readAheadSize < m_maxReadAheadSize) {
+        m_readAheadSize *= 2;
+      }
+      m_readAheadSize = std::min(m_readAheadSize, m_maxReadAheadSize);
+      m_smallReadCount = 0;
+    } else if(size < m_readAheadSize / 8 &&
+        m_readAheadSize > m_minReadAheadSize) {
+      ++m_smallReadCount;
+      if(m_smallReadCount == DECAY_COUNT) {
+        m_readAheadSize = std::max(m_readAheadSize / 2, m_minReadAheadSize);
+        m_smallReadCount = 0;
+      }
+    } else {
+      m_smallReadCount = 0;
+    }
+  }
+
+  template<typename R>
+  void BufferedReader<R>::Increment(std::atomic<std::uint64_t>& counter) {
+    counter.store(counter.load(std::memory_order_relaxed) + 1,
+      std::memory_order_relaxed);
+  }
+
+  template<typename R>
+  void BufferedReader<R>::Fill() {
+    m_buffer.Reset();
+    m_position = 0;
+    m_buffer.Grow(m_readAheadSize);
+    auto readSize = std::size_t(0);
+    try {
+      Increment(m_sourceReads);
+      readSize = m_source->Read(m_buffer.GetMutableData(), m_readAheadSize);
+    } catch(const std::exception&) {
+      m_buffer.Reset();
+      throw;
+    }
+    m_buffer.Shrink(m_readAheadSize - readSize);
+  }
+}
+
+  template<typename R>
+  struct ImplementsConcept<IO::BufferedReader<R>, IO::Reader> :
+    std::true_type {};
+}
+
+#endif
@@ -9,7 +9,10 @@ namespace Beam::IO {
   template<typename S> class BasicOStreamWriter;
   struct Buffer;
   class BufferBox;
+  class BufferChain;
+  template<typename R> class BufferedReader;
   template<typename B> class BaseBufferOutputStream;
+  class BufferPool;
   template<typename B> class BufferSlice;
   class BufferView;
   template<typename I, typename C, typename R, typename W> struct Channel;
@@ -22,6 +25,7 @@ namespace Beam::IO {
   class ConnectionBox;
   class EndOfFileException;
   class IOException;
+  template<std::size_t N> class InlineBuffer;
   template<typename B> class LocalClientChannel;
   template<typename B> class LocalConnection;
   template<typename B> class LocalServerChannel;
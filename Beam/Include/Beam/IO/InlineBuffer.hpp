@@ -0,0 +1,345 @@
+#ifndef BEAM_INLINE_BUFFER_HPP
+#define BEAM_INLINE_BUFFER_HPP
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include "Beam/IO/BufferView.hpp"
+#include "Beam/IO/IO.hpp"
+#include "Beam/IO/SharedBuffer.hpp"
+
+namespace Beam {
+namespace IO {
+
+  /**
+   * Implements the Buffer Concept by storing small payloads within the
+   * object itself, spilling over to a SharedBuffer once the payload outgrows
+   * the inline storage. Copies of a spilled buffer share their data.
+   * @param <N> The number of bytes stored inline.
+   */
+  template<std::size_t N = 128>
+  class InlineBuffer {
+    public:
+
+      /** The number of bytes stored inline. */
+      static constexpr std::size_t INLINE_SIZE = N;
+
+      /** Constructs an empty InlineBuffer. */
+      InlineBuffer();
+
+      /**
+       * Constructs an InlineBuffer with a pre-allocated initial size.
+       * @param initialSize The initial size to pre-allocate.
+       */
+      explicit InlineBuffer(std::size_t initialSize);
+
+      InlineBuffer(const void* data, std::size_t size);
+
+      InlineBuffer(const InlineBuffer& buffer);
+
+      template<typename B, typename = std::enable_if_t<
+        IsBufferView<B> && !std::is_same_v<B, InlineBuffer>>>
+      InlineBuffer(const B& buffer);
+
+      InlineBuffer(InlineBuffer&& buffer);
+
+      /**
+       * Returns <code>true</code> iff the data is stored inline rather than
+       * in a SharedBuffer.
+       */
+      bool IsInline() const;
+
+      bool IsEmpty() const;
+
+      void Grow(std::size_t size);
+
+      void Shrink(std::size_t size);
+
+      void ShrinkFront(std::size_t size);
+
+      void Reserve(std::size_t size);
+
+      void Write(std::size_t index, const void* source, std::size_t size);
+
+      template<typename T>
+      void Write(std::size_t index, T value);
+
+      template<typename Buffer>
+      std::enable_if_t<IsBufferView<Buffer>> Append(const Buffer& buffer);
+
+      void Append(const void* data, std::size_t size);
+
+      template<typename T>
+      std::enable_if_t<!IsBufferView<T>> Append(T value);
+
+      void Reset();
+
+      const char* GetData() const;
+
+      char* GetMutableData();
+
+      std::size_t GetSize() const;
+
+      template<typename T>
+      void Extract(std::size_t index, Out<T> value) const;
+
+      template<typename T>
+      T Extract(std::size_t index) const;
+
+      InlineBuffer& operator =(const InlineBuffer& rhs);
+
+      template<typename Buffer>
+      std::enable_if_t<IsBufferView<Buffer>, InlineBuffer&> operator =(
+        const Buffer& rhs);
+
+      InlineBuffer& operator =(InlineBuffer&& rhs);
+
+    private:
+      std::size_t m_size;
+      bool m_isInline;
+      SharedBuffer m_shared;
+      alignas(std::max_align_t) char m_data[N];
+
+      void Spill(std::size_t capacity);
+  };
+
+  template<std::size_t N>
+  InlineBuffer<N>::InlineBuffer()
+    : m_size(0),
+      m_isInline(true) {}
+
+  template<std::size_t N>
+  InlineBuffer<N>::InlineBuffer(std::size_t initialSize)
+      : InlineBuffer() {
+    Grow(initialSize);
+  }
+
+  template<std::size_t N>
+  InlineBuffer<N>::InlineBuffer(const void* data, std::size_t size)
+      : InlineBuffer() {
+    Append(data, size);
+  }
+
+  template<std::size_t N>
+  InlineBuffer<N>::InlineBuffer(const InlineBuffer& buffer)
+      : m_size(buffer.m_size),
+        m_isInline(buffer.m_isInline),
+        m_shared(buffer.m_shared) {
+    if(m_isInline) {
+      std::memcpy(m_data, buffer.m_data, m_size);
+    }
+  }
+
+  template<std::size_t N>
+  template<typename B, typename>
+  InlineBuffer<N>::InlineBuffer(const B& buffer)
+      : InlineBuffer() {
+    Append(buffer);
+  }
+
+  template<std::size_t N>
+  InlineBuffer<N>::InlineBuffer(InlineBuffer&& buffer)
+      : m_size(buffer.m_size),
+        m_isInline(buffer.m_isInline),
+        m_shared(std::move(buffer.m_shared)) {
+    if(m_isInline) {
+      std::memcpy(m_data, buffer.m_data, m_size);
+    }
+    buffer.Reset();
+  }
+
+  template<std::size_t N>
+  bool InlineBuffer<N>::IsInline() const {
+    return m_isInline;
+  }
+
+  template<std::size_t N>
+  bool InlineBuffer<N>::IsEmpty() const {
+    return GetSize() == 0;
+  }
+
+  template<std::size_t N>
+  void InlineBuffer<N>::Grow(std::size_t size) {
+    if(m_isInline) {
+      if(m_size + size <= N) {
+        m_size += size;
+        return;
+      }
+      Spill(m_size + size);
+    }
+    m_shared.Grow(size);
+  }
+
+  template<std::size_t N>
+  void InlineBuffer<N>::Shrink(std::size_t size) {
+    if(m_isInline) {
+      m_size -= std::min(size, m_size);
+    } else {
+      m_shared.Shrink(size);
+    }
+  }
+
+  template<std::size_t N>
+  void InlineBuffer<N>::ShrinkFront(std::size_t size) {
+    if(m_isInline) {
+      size = std::min(size, m_size);
+      std::memmove(m_data, m_data + size, m_size - size);
+      m_size -= size;
+    } else {
+      m_shared.ShrinkFront(size);
+    }
+  }
+
+  template<std::size_t N>
+  void InlineBuffer<N>::Reserve(std::size_t size) {
+    Grow(size - GetSize());
+  }
+
+  template<std::size_t N>
+  void InlineBuffer<N>::Write(std::size_t index, const void* source,
+      std::size_t size) {
+    assert(index <= GetSize());
+    if(m_isInline) {
+      if(index + size <= N) {
+        std::memcpy(m_data + index, source, size);
+        m_size = std::max(index + size, m_size);
+        return;
+      }
+      Spill(index + size);
+    }
+    m_shared.Write(index, source, size);
+  }
+
+  template<std::size_t N>
+  template<typename T>
+  void InlineBuffer<N>::Write(std::size_t index, T value) {
+    Write(index, &value, sizeof(T));
+  }
+
+  template<std::size_t N>
+  template<typename Buffer>
+  std::enable_if_t<IsBufferView<Buffer>> InlineBuffer<N>::Append(
+      const Buffer& buffer) {
+    Append(buffer.GetData(), buffer.GetSize());
+  }
+
+  template<std::size_t N>
+  void InlineBuffer<N>::Append(const void* data, std::size_t size) {
+    if(m_isInline) {
+      if(m_size + size <= N) {
+        std::memcpy(m_data + m_size, data, size);
+        m_size += size;
+        return;
+      }
+      Spill(m_size + size);
+    }
+    m_shared.Append(data, size);
+  }
+
+  template<std::size_t N>
+  template<typename T>
+  std::enable_if_t<!IsBufferView<T>> InlineBuffer<N>::Append(T value) {
+    Append(&value, sizeof(T));
+  }
+
+  template<std::size_t N>
+  void InlineBuffer<N>::Reset() {
+    m_size = 0;
+    if(!m_isInline) {
+      m_shared = SharedBuffer();
+      m_isInline = true;
+    }
+  }
+
+  template<std::size_t N>
+  const char* InlineBuffer<N>::GetData() const {
+    if(m_isInline) {
+      return m_data;
+    }
+    return m_shared.GetData();
+  }
+
+  template<std::size_t N>
+  char* InlineBuffer<N>::GetMutableData() {
+    if(m_isInline) {
+      return m_data;
+    }
+    return m_shared.GetMutableData();
+  }
+
+  template<std::size_t N>
+  std::size_t InlineBuffer<N>::GetSize() const {
+    if(m_isInline) {
+      return m_size;
+    }
+    return m_shared.GetSize();
+  }
+
+  template<std::size_t N>
+  template<typename T>
+  void InlineBuffer<N>::Extract(std::size_t index, Out<T> value) const {
+    std::memcpy(reinterpret_cast<char*>(&*value), GetData() + index,
+      sizeof(T));
+  }
+
+  template<std::size_t N>
+  template<typename T>
+  T InlineBuffer<N>::Extract(std::size_t index) const {
+    auto value = T();
+    Extract(index, Store(value));
+    return value;
+  }
+
+  template<std::size_t N>
+  InlineBuffer<N>& InlineBuffer<N>::operator =(const InlineBuffer& rhs) {
+    if(this == &rhs) {
+      return *this;
+    }
+    m_size = rhs.m_size;
+    m_isInline = rhs.m_isInline;
+    m_shared = rhs.m_shared;
+    if(m_isInline) {
+      std::memcpy(m_data, rhs.m_data, m_size);
+    }
+    return *this;
+  }
+
+  template<std::size_t N>
+  template<typename Buffer>
+  std::enable_if_t<IsBufferView<Buffer>, InlineBuffer<N>&>
+      InlineBuffer<N>::operator =(const Buffer& rhs) {
+    Reset();
+    Append(rhs);
+    return *this;
+  }
+
+  template<std::size_t N>
+  InlineBuffer<N>& InlineBuffer<N>::operator =(InlineBuffer&& rhs) {
+    if(this == &rhs) {
+      return *this;
+    }
+    m_size = rhs.m_size;
+    m_isInline = rhs.m_isInline;
+    m_shared = std::move(rhs.m_shared);
+    if(m_isInline) {
+      std::memcpy(m_data, rhs.m_data, m_size);
+    }
+    rhs.Reset();
+    return *this;
+  }
+
+  template<std::size_t N>
+  void InlineBuffer<N>::Spill(std::size_t capacity) {
+    m_shared = SharedBuffer(capacity);
+    std::memcpy(m_shared.GetMutableData(), m_data, m_size);
+    m_shared.Shrink(capacity - m_size);
+    m_isInline = false;
+  }
+}
+
+  template<std::size_t N>
+  struct ImplementsConcept<IO::InlineBuffer<N>, IO::Buffer> : std::true_type {};
+}
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef BEAM_PIPED_WRITER_HPP
 #define BEAM_PIPED_WRITER_HPP
 #include <memory>
+#include <type_traits>
+#include "Beam/IO/BufferChain.hpp"
 #include "Beam/IO/EndOfFileException.hpp"
 #include "Beam/IO/PipedReader.hpp"
 #include "Beam/IO/Writer.hpp"
@@ -47,6 +49,12 @@ namespace IO {
 
       void Write(const Buffer& data);
 
+      /**
+       * Writes every segment of a BufferChain as a single message.
+       * @param data The data to write.
+       */
+      void Write(const BufferChain& data);
+
     private:
       std::shared_ptr<Queue<BufferReader<Buffer>>> m_messages;
 
@@ -88,8 +96,24 @@ namespace IO {
   void PipedWriter<B>::Write(const Buffer& data) {
     m_messages->Push(BufferReader(data));
   }
+
+  template<typename B>
+  void PipedWriter<B>::Write(const BufferChain& data) {
+    if constexpr(std::is_same_v<Buffer, SharedBuffer>) {
+      Write(data.Flatten());
+    } else {
+      auto buffer = Buffer();
+      for(auto& segment : data.GetSegments()) {
+        buffer.Append(segment.GetData(), segment.GetSize());
+      }
+      Write(buffer);
+    }
+  }
 }
 
+  template<typename B>
+  struct IO::VectoredWriteSupport<IO::PipedWriter<B>> : std::true_type {};
+
   template<typename B>
   struct ImplementsConcept<IO::PipedWriter<B>,
     IO::Writer<typename IO::PipedWriter<B>::Buffer>> : std::true_type {};
@@ -1,30 +1,105 @@
 #ifndef BEAM_SHARED_BUFFER_HPP
 #define BEAM_SHARED_BUFFER_HPP
+#include <atomic>
 #include <cstring>
 #include <new>
-#include <boost/shared_array.hpp>
-#include <boost/throw_exception.hpp>
+#include <utility>
+#include "Beam/IO/BufferPool.hpp"
 #include "Beam/IO/BufferView.hpp"
 #include "Beam/Utilities/BeamWorkaround.hpp"
 
 namespace Beam {
 namespace IO {
 namespace Details {
-  inline std::size_t FindNextPowerOfTwo(std::size_t current) {
-    auto nextPowerOfTwo = std::size_t(1);
-    auto lastPowerOfTwo = nextPowerOfTwo;
-    while(nextPowerOfTwo < current) {
-      nextPowerOfTwo *= 2;
-      if(nextPowerOfTwo < lastPowerOfTwo) {
-        BOOST_THROW_EXCEPTION(std::bad_alloc());
+  /**
+   * Reference counted storage drawn from the BufferPool, the counter is kept
+   * at the front of the block so that sharing requires no further allocation.
+   */
+  class SharedBufferData {
+    public:
+      SharedBufferData() noexcept
+        : m_header(nullptr) {}
+
+      explicit SharedBufferData(std::size_t size) {
+        auto blockSize = BufferPool::GetBlockSize(size + sizeof(Header));
+        m_header = new(BufferPool::GetInstance().Allocate(blockSize)) Header{
+          {1}, blockSize};
       }
-      lastPowerOfTwo = nextPowerOfTwo;
-    }
-    return nextPowerOfTwo;
-  }
+
+      SharedBufferData(const SharedBufferData& data) noexcept
+          : m_header(data.m_header) {
+        if(m_header) {
+          m_header->m_referenceCount.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+
+      SharedBufferData(SharedBufferData&& data) noexcept
+          : m_header(data.m_header) {
+        data.m_header = nullptr;
+      }
+
+      ~SharedBufferData() {
+        reset();
+      }
+
+      std::size_t capacity() const {
+        if(!m_header) {
+          return 0;
+        }
+        return m_header->m_blockSize - sizeof(Header);
+      }
+
+      char* get() const {
+        if(!m_header) {
+          return nullptr;
+        }
+        return reinterpret_cast<char*>(m_header + 1);
+      }
+
+      bool unique() const {
+        return m_header &&
+          m_header->m_referenceCount.load(std::memory_order_acquire) == 1;
+      }
+
+      void reset() {
+        if(m_header && m_header->m_referenceCount.fetch_sub(1,
+            std::memory_order_acq_rel) == 1) {
+          auto blockSize = m_header->m_blockSize;
+          m_header->~Header();
+          BufferPool::GetInstance().Deallocate(m_header, blockSize);
+        }
+        m_header = nullptr;
+      }
+
+      void swap(SharedBufferData& data) noexcept {
+        std::swap(m_header, data.m_header);
+      }
+
+      SharedBufferData& operator =(const SharedBufferData& data) noexcept {
+        auto copy = data;
+        swap(copy);
+        return *this;
+      }
+
+      SharedBufferData& operator =(SharedBufferData&& data) noexcept {
+        auto moved = std::move(data);
+        swap(moved);
+        return *this;
+      }
+
+    private:
+      struct alignas(std::max_align_t) Header {
+        std::atomic_size_t m_referenceCount;
+        std::size_t m_blockSize;
+      };
+      Header* m_header;
+  };
 }
 
-  /** Implements the Buffer Concept using copy-on-write data. */
+  /**
+   * Implements the Buffer Concept using copy-on-write data allocated from the
+   * BufferPool.
+   */
   class SharedBuffer {
     public:
 
@@ -95,10 +170,10 @@ namespace Details {
     private:
       std::size_t m_size;
       std::size_t m_availableSize;
-      boost::shared_array<char> m_data;
+      Details::SharedBufferData m_data;
       char* m_front;
 
-      void Reallocate();
+      void Reallocate(std::size_t size);
   };
 
   inline SharedBuffer::SharedBuffer()
@@ -108,9 +183,10 @@ namespace Details {
 
   inline SharedBuffer::SharedBuffer(std::size_t initialSize)
     : m_size(initialSize),
-      m_availableSize(Details::FindNextPowerOfTwo(initialSize)),
-      m_data(new char[m_availableSize]),
-      m_front(m_data.get()) {}
+      m_data(initialSize),
+      m_front(m_data.get()) {
+    m_availableSize = m_data.capacity();
+  }
 
   inline SharedBuffer::SharedBuffer(const void* data, std::size_t size)
       : m_size(0),
@@ -145,8 +221,7 @@ namespace Details {
 
   inline void SharedBuffer::Grow(std::size_t size) {
     if(m_size + size > m_availableSize) {
-      m_availableSize = Details::FindNextPowerOfTwo(m_size + size);
-      Reallocate();
+      Reallocate(m_size + size);
     }
     m_size += size;
   }
@@ -162,7 +237,7 @@ namespace Details {
 
   inline void SharedBuffer::ShrinkFront(std::size_t size) {
     assert(size >= 0);
-    auto data = boost::shared_array<char>{new char[m_availableSize]};
+    auto data = Details::SharedBufferData(m_availableSize);
     std::memcpy(data.get(), m_data.get() + size, m_size - size);
     data.swap(m_data);
     m_size -= size;
@@ -177,10 +252,9 @@ namespace Details {
       std::size_t size) {
     assert(index <= m_size);
     if(m_availableSize < index + size) {
-      m_availableSize = Details::FindNextPowerOfTwo(index + size);
-      Reallocate();
+      Reallocate(index + size);
     } else if(!m_data.unique()) {
-      Reallocate();
+      Reallocate(m_availableSize);
     }
     std::memcpy(m_front + index, source, size);
     m_size = std::max(index + size, m_size);
@@ -207,10 +281,9 @@ namespace Details {
 
   inline void SharedBuffer::Append(const void* data, std::size_t size) {
     if(m_availableSize < m_size + size) {
-      m_availableSize = Details::FindNextPowerOfTwo(m_size + size);
-      Reallocate();
+      Reallocate(m_size + size);
     } else if(!m_data.unique()) {
-      Reallocate();
+      Reallocate(m_availableSize);
     }
     std::memcpy(m_front + m_size, data, size);
     m_size += size;
@@ -232,7 +305,7 @@ namespace Details {
 
   inline char* SharedBuffer::GetMutableData() {
     if(!m_data.unique()) {
-      Reallocate();
+      Reallocate(m_availableSize);
     }
     return m_front;
   }
@@ -276,9 +349,10 @@ namespace Details {
     return *this;
   }
 
-  inline void SharedBuffer::Reallocate() {
+  inline void SharedBuffer::Reallocate(std::size_t size) {
     auto oldData = std::move(m_data);
-    m_data.reset(new char[m_availableSize]);
+    m_data = Details::SharedBufferData(size);
+    m_availableSize = m_data.capacity();
     std::memcpy(m_data.get(), oldData.get(), m_size);
     m_front = m_data.get() + (m_front - oldData.get());
   }
@@ -1,10 +1,12 @@
 #ifndef BEAM_SIZE_DECLARATIVE_WRITER_HPP
 #define BEAM_SIZE_DECLARATIVE_WRITER_HPP
 #include <type_traits>
+#include "Beam/IO/BufferChain.hpp"
 #include "Beam/IO/SharedBuffer.hpp"
 #include "Beam/IO/Writer.hpp"
 #include "Beam/Pointers/Dereference.hpp"
 #include "Beam/Pointers/LocalPtr.hpp"
+#include "Beam/Utilities/Endian.hpp"
 
 namespace Beam {
 namespace IO {
@@ -30,6 +32,12 @@ namespace IO {
 
       void Write(const void* data, std::size_t size);
 
+      /**
+       * Writes a Buffer or a BufferChain. When the destination supports
+       * vectored writes, the size is sent as its own segment rather than
+       * being copied together with the data into a new Buffer.
+       * @param data The data to write.
+       */
       template<typename B>
       void Write(const B& data);
 
@@ -65,10 +73,28 @@ namespace IO {
   template<typename W>
   template<typename B>
   void SizeDeclarativeWriter<W>::Write(const B& data) {
-    return Write(data.GetData(), data.GetSize());
+    if constexpr(std::is_same_v<B, BufferChain>) {
+      auto portableInt = ToLittleEndian(
+        static_cast<std::uint32_t>(data.GetSize()));
+      auto chain = data;
+      chain.Prepend(SharedBuffer(&portableInt, sizeof(std::uint32_t)));
+      WriteChain(*m_destination, chain);
+    } else if constexpr(std::is_same_v<B, SharedBuffer> &&
+        VectoredWriteSupport<DestinationWriter>::value) {
+      auto portableInt = ToLittleEndian(
+        static_cast<std::uint32_t>(data.GetSize()));
+      m_destination->Write(BufferChain{
+        SharedBuffer(&portableInt, sizeof(std::uint32_t)), data});
+    } else {
+      return Write(data.GetData(), data.GetSize());
+    }
   }
 }
 
+  template<typename W>
+  struct IO::VectoredWriteSupport<IO::SizeDeclarativeWriter<W>> :
+    std::true_type {};
+
   template<typename B, typename W>
   struct ImplementsConcept<IO::SizeDeclarativeWriter<W>, IO::Writer<B>> :
     std::true_type {};
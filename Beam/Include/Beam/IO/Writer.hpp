@@ -2,6 +2,7 @@
 #define BEAM_WRITER_HPP
 #include <type_traits>
 #include "Beam/IO/Buffer.hpp"
+#include "Beam/IO/IO.hpp"
 #include "Beam/Utilities/Concept.hpp"
 #include "Beam/Utilities/StaticMemberChecks.hpp"
 
@@ -35,6 +36,13 @@ namespace Details {
      * @param result The result of the write.
      */
     void Write(const Buffer& data);
+
+    /**
+     * Writes every segment of a BufferChain as a single unit, only required
+     * of Writers that specialize VectoredWriteSupport.
+     * @param data The data to write.
+     */
+    void Write(const BufferChain& data);
   };
 
   /**
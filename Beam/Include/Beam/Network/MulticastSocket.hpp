@@ -93,7 +93,6 @@ namespace Beam::Network {
       const IpAddress& interface, const MulticastSocketOptions& options)
       : m_group(group),
         m_socket(std::make_shared<Details::UdpSocketEntry>(
-          Threading::ServiceThreadPool::GetInstance().GetService(),
           Threading::ServiceThreadPool::GetInstance().GetService(),
           boost::asio::ip::udp::v4())) {
     Open(interface, options);
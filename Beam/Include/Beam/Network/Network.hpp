@@ -14,6 +14,11 @@ namespace Beam::Network {
   struct SecureSocketOptions;
   class SecureSocketReader;
   class SecureSocketWriter;
+  class SharedMemoryChannel;
+  class SharedMemoryConnection;
+  class SharedMemoryReader;
+  class SharedMemoryServerConnection;
+  class SharedMemoryWriter;
   class SocketException;
   class SocketIdentifier;
   class TcpServerSocket;
@@ -2,10 +2,13 @@
 #define BEAM_NETWORK_DETAILS_HPP
 #include <memory>
 #include <utility>
+#include <boost/asio/buffer.hpp>
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ssl.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ip/udp.hpp>
+#include <boost/container/small_vector.hpp>
+#include "Beam/IO/BufferChain.hpp"
 #include "Beam/IO/EndOfFileException.hpp"
 #include "Beam/Network/Network.hpp"
 #include "Beam/Threading/ConditionVariable.hpp"
@@ -26,7 +29,7 @@ namespace Beam::Network::Details {
     template<typename... Args>
     SocketEntry(boost::asio::io_service& ioService, Args&&... args)
       : m_ioService(&ioService),
-        m_socket(std::forward<Args>(args)...),
+        m_socket(ioService, std::forward<Args>(args)...),
         m_isOpen(false),
         m_isReadPending(false),
         m_pendingWrites(0) {}
@@ -85,11 +88,10 @@ namespace Beam::Network::Details {
     int m_pendingWrites;
     Threading::ConditionVariable m_isPendingCondition;
 
-    template<typename... Args>
-    SecureSocketEntry(boost::asio::io_service& ioService, Args&&... args)
+    explicit SecureSocketEntry(boost::asio::io_service& ioService)
       : m_ioService(&ioService),
         m_context(boost::asio::ssl::context::sslv23),
-        m_socket(std::forward<Args>(args)..., m_context),
+        m_socket(ioService, m_context),
         m_isOpen(false),
         m_isReadPending(false),
         m_pendingWrites(0) {}
@@ -149,6 +151,18 @@ namespace Beam::Network::Details {
       error == boost::asio::error::shut_down ||
       error == boost::asio::error::timed_out;
   }
+
+  using ConstBufferSequence = boost::container::small_vector<
+    boost::asio::const_buffer, IO::BufferChain::INLINE_SEGMENTS>;
+
+  inline ConstBufferSequence MakeBufferSequence(const IO::BufferChain& chain) {
+    auto buffers = ConstBufferSequence();
+    for(auto& segment : chain.GetSegments()) {
+      buffers.push_back(
+        boost::asio::buffer(segment.GetData(), segment.GetSize()));
+    }
+    return buffers;
+  }
 }
 
 #endif
@@ -100,7 +100,7 @@ namespace Network {
       Reader m_reader;
       Writer m_writer;
 
-      SecureSocketChannel();
+      explicit SecureSocketChannel(std::size_t shard);
       SecureSocketChannel(const SecureSocketChannel&) = delete;
       SecureSocketChannel& operator =(const SecureSocketChannel&) = delete;
       void SetAddress(const IpAddress& address);
@@ -129,8 +129,8 @@ namespace Network {
   inline SecureSocketChannel::SecureSocketChannel(
     const std::vector<IpAddress>& addresses, const SecureSocketOptions& options)
     : m_socket(std::make_shared<Details::SecureSocketEntry>(
-        Threading::ServiceThreadPool::GetInstance().GetService(),
-        Threading::ServiceThreadPool::GetInstance().GetService())),
+        Threading::ServiceThreadPool::GetInstance().GetService(
+          options.m_shard))),
       m_identifier(addresses.front()),
       m_connection(m_socket, options, addresses),
       m_reader(m_socket),
@@ -144,8 +144,8 @@ namespace Network {
     const std::vector<IpAddress>& addresses, const IpAddress& interface,
     const SecureSocketOptions& options)
     : m_socket(std::make_shared<Details::SecureSocketEntry>(
-        Threading::ServiceThreadPool::GetInstance().GetService(),
-        Threading::ServiceThreadPool::GetInstance().GetService())),
+        Threading::ServiceThreadPool::GetInstance().GetService(
+          options.m_shard))),
       m_identifier(addresses.front()),
       m_connection(m_socket, options, addresses, interface),
       m_reader(m_socket),
@@ -168,10 +168,9 @@ namespace Network {
     return m_writer;
   }
 
-  inline SecureSocketChannel::SecureSocketChannel()
+  inline SecureSocketChannel::SecureSocketChannel(std::size_t shard)
     : m_socket(std::make_shared<Details::SecureSocketEntry>(
-        Threading::ServiceThreadPool::GetInstance().GetService(),
-        Threading::ServiceThreadPool::GetInstance().GetService())),
+        Threading::ServiceThreadPool::GetInstance().GetService(shard))),
       m_connection(m_socket),
       m_reader(m_socket),
       m_writer(m_socket) {}
@@ -2,6 +2,7 @@
 #define BEAM_SECURE_SOCKET_WRITER_HPP
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/write.hpp>
+#include "Beam/IO/BufferChain.hpp"
 #include "Beam/IO/EndOfFileException.hpp"
 #include "Beam/IO/IO.hpp"
 #include "Beam/IO/SharedBuffer.hpp"
@@ -22,6 +23,12 @@ namespace Network {
 
       void Write(const void* data, std::size_t size);
 
+      /**
+       * Writes every segment of a BufferChain using a single vectored write.
+       * @param data The data to write.
+       */
+      void Write(const IO::BufferChain& data);
+
       template<typename BufferType>
       void Write(const BufferType& data);
 
@@ -33,16 +40,35 @@ namespace Network {
       SecureSocketWriter(std::shared_ptr<Details::SecureSocketEntry> socket);
       SecureSocketWriter(const SecureSocketWriter&) = delete;
       SecureSocketWriter& operator =(const SecureSocketWriter&) = delete;
+      template<typename B>
+      void WriteBuffers(const B& buffers);
   };
 
   inline void SecureSocketWriter::Write(const void* data, std::size_t size) {
+    WriteBuffers(boost::asio::buffer(data, size));
+  }
+
+  inline void SecureSocketWriter::Write(const IO::BufferChain& data) {
+    WriteBuffers(Details::MakeBufferSequence(data));
+  }
+
+  template<typename BufferType>
+  void SecureSocketWriter::Write(const BufferType& data) {
+    Write(data.GetData(), data.GetSize());
+  }
+
+  inline SecureSocketWriter::SecureSocketWriter(
+    std::shared_ptr<Details::SecureSocketEntry> socket)
+    : m_socket(std::move(socket)) {}
+
+  template<typename B>
+  void SecureSocketWriter::WriteBuffers(const B& buffers) {
     auto writeResult = Routines::Async<void>();
     m_socket->BeginWriteOperation();
     m_tasks.Add(
       [&] {
         auto lock = std::lock_guard(m_socket->m_mutex);
-        boost::asio::async_write(m_socket->m_socket,
-          boost::asio::buffer(data, size),
+        boost::asio::async_write(m_socket->m_socket, buffers,
           [&] (const auto& error, auto writeSize) {
             if(error) {
               writeResult.GetEval().SetException(SocketException(
@@ -60,17 +86,12 @@ namespace Network {
       std::throw_with_nested(IO::EndOfFileException());
     }
   }
-
-  template<typename BufferType>
-  void SecureSocketWriter::Write(const BufferType& data) {
-    Write(data.GetData(), data.GetSize());
-  }
-
-  inline SecureSocketWriter::SecureSocketWriter(
-    std::shared_ptr<Details::SecureSocketEntry> socket)
-    : m_socket(std::move(socket)) {}
 }
 
+  template<>
+  struct IO::VectoredWriteSupport<Network::SecureSocketWriter> :
+    std::true_type {};
+
   template<typename BufferType>
   struct ImplementsConcept<Network::SecureSocketWriter,
     IO::Writer<BufferType>> : std::true_type {};
@@ -0,0 +1,100 @@
+#ifndef BEAM_SHARED_MEMORY_CHANNEL_HPP
+#define BEAM_SHARED_MEMORY_CHANNEL_HPP
+#include <memory>
+#include <string>
+#include "Beam/IO/Channel.hpp"
+#include "Beam/IO/NamedChannelIdentifier.hpp"
+#include "Beam/Network/Network.hpp"
+#include "Beam/Network/SharedMemoryConnection.hpp"
+#include "Beam/Network/SharedMemoryDetails.hpp"
+#include "Beam/Network/SharedMemoryReader.hpp"
+#include "Beam/Network/SharedMemoryWriter.hpp"
+#include "Beam/Threading/ServiceThreadPool.hpp"
+
+namespace Beam {
+namespace Network {
+
+  /**
+   * Implements the Channel interface using a pair of rings in shared memory,
+   * for use between processes on the same host.
+   */
+  class SharedMemoryChannel {
+    public:
+      using Identifier = IO::NamedChannelIdentifier;
+      using Connection = SharedMemoryConnection;
+      using Reader = SharedMemoryReader;
+      using Writer = SharedMemoryWriter;
+
+      /**
+       * Constructs a SharedMemoryChannel.
+       * @param path The path of the SharedMemoryServerConnection to connect
+       *        to.
+       */
+      explicit SharedMemoryChannel(const std::string& path);
+
+      const Identifier& GetIdentifier() const;
+
+      Connection& GetConnection();
+
+      Reader& GetReader();
+
+      Writer& GetWriter();
+
+    private:
+      friend class SharedMemoryServerConnection;
+      std::shared_ptr<Details::SharedMemoryEntry> m_entry;
+      Identifier m_identifier;
+      Connection m_connection;
+      Reader m_reader;
+      Writer m_writer;
+
+      SharedMemoryChannel(std::shared_ptr<Details::SharedMemoryEntry> entry,
+        const std::string& path);
+      SharedMemoryChannel(const SharedMemoryChannel&) = delete;
+      SharedMemoryChannel& operator =(const SharedMemoryChannel&) = delete;
+  };
+
+  inline SharedMemoryChannel::SharedMemoryChannel(const std::string& path)
+    : m_entry(std::make_shared<Details::SharedMemoryEntry>(
+        Threading::ServiceThreadPool::GetInstance().GetService())),
+      m_identifier(path),
+      m_connection(m_entry, path),
+      m_reader(m_entry),
+      m_writer(m_entry) {}
+
+  inline const SharedMemoryChannel::Identifier&
+      SharedMemoryChannel::GetIdentifier() const {
+    return m_identifier;
+  }
+
+  inline SharedMemoryChannel::Connection&
+      SharedMemoryChannel::GetConnection() {
+    return m_connection;
+  }
+
+  inline SharedMemoryChannel::Reader& SharedMemoryChannel::GetReader() {
+    return m_reader;
+  }
+
+  inline SharedMemoryChannel::Writer& SharedMemoryChannel::GetWriter() {
+    return m_writer;
+  }
+
+  inline SharedMemoryChannel::SharedMemoryChannel(
+    std::shared_ptr<Details::SharedMemoryEntry> entry, const std::string& path)
+    : m_entry(std::move(entry)),
+      m_identifier(path),
+      m_connection(m_entry),
+      m_reader(m_entry),
+      m_writer(m_entry) {}
+}
+
+  template<>
+  struct ImplementsConcept<Network::SharedMemoryChannel, IO::Channel<
+    Network::SharedMemoryChannel::Identifier,
+    Network::SharedMemoryChannel::Connection,
+    Network::SharedMemoryChannel::Reader,
+    Network::SharedMemoryChannel::Writer>> : std::true_type {};
+}
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef BEAM_SHARED_MEMORY_CONNECTION_HPP
+#define BEAM_SHARED_MEMORY_CONNECTION_HPP
+#include <memory>
+#include <string>
+#include "Beam/IO/Connection.hpp"
+#include "Beam/IO/ConnectException.hpp"
+#include "Beam/IO/OpenState.hpp"
+#include "Beam/Network/Network.hpp"
+#include "Beam/Network/SharedMemoryDetails.hpp"
+
+namespace Beam {
+namespace Network {
+
+  /** Implements a Connection over a pair of shared memory rings. */
+  class SharedMemoryConnection {
+    public:
+      ~SharedMemoryConnection();
+
+      void Close();
+
+    private:
+      friend class SharedMemoryChannel;
+      friend class SharedMemoryServerConnection;
+      std::shared_ptr<Details::SharedMemoryEntry> m_entry;
+      IO::OpenState m_openState;
+
+      SharedMemoryConnection(std::shared_ptr<Details::SharedMemoryEntry> entry);
+      SharedMemoryConnection(std::shared_ptr<Details::SharedMemoryEntry> entry,
+        const std::string& path);
+      SharedMemoryConnection(const SharedMemoryConnection&) = delete;
+      SharedMemoryConnection& operator =(
+        const SharedMemoryConnection&) = delete;
+      void Open(const std::string& path);
+  };
+
+  inline SharedMemoryConnection::~SharedMemoryConnection() {
+    Close();
+  }
+
+  inline void SharedMemoryConnection::Close() {
+    if(m_openState.SetClosing()) {
+      return;
+    }
+    m_entry->Close();
+    m_openState.Close();
+  }
+
+  inline SharedMemoryConnection::SharedMemoryConnection(
+    std::shared_ptr<Details::SharedMemoryEntry> entry)
+    : m_entry(std::move(entry)) {}
+
+  inline SharedMemoryConnection::SharedMemoryConnection(
+      std::shared_ptr<Details::SharedMemoryEntry> entry,
+      const std::string& path)
+      : m_entry(std::move(entry)) {
+    Open(path);
+  }
+
+  inline void SharedMemoryConnection::Open(const std::string& path) {
+    try {
+      auto errorCode = boost::system::error_code();
+      m_entry->m_socket.connect(
+        boost::asio::local::stream_protocol::endpoint(path), errorCode);
+      if(errorCode) {
+        BOOST_THROW_EXCEPTION(SocketException(errorCode.value(),
+          errorCode.message()));
+      }
+      m_entry->OpenClient();
+    } catch(const IO::ConnectException&) {
+      Close();
+      BOOST_RETHROW;
+    } catch(const std::exception&) {
+      Close();
+      std::throw_with_nested(IO::ConnectException(
+        "Unable to open shared memory channel."));
+    }
+  }
+}
+
+  template<>
+  struct ImplementsConcept<Network::SharedMemoryConnection, IO::Connection> :
+    std::true_type {};
+}
+
+#endif
@@ -0,0 +1,347 @@
+#ifndef BEAM_SHARED_MEMORY_DETAILS_HPP
+#define BEAM_SHARED_MEMORY_DETAILS_HPP
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unistd.h>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/throw_exception.hpp>
+#include "Beam/IO/ConnectException.hpp"
+#include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/Network/Network.hpp"
+#include "Beam/Network/SocketException.hpp"
+#include "Beam/Routines/Async.hpp"
+#include "Beam/Threading/Mutex.hpp"
+
+namespace Beam::Network::Details {
+  static_assert(std::atomic<std::uint64_t>::is_always_lock_free &&
+    std::atomic<bool>::is_always_lock_free,
+    "Shared memory rings require lock-free atomics.");
+
+  /** The control block of a single-producer/single-consumer byte ring. */
+  struct SharedMemoryRing {
+
+    /** The total number of bytes written to the ring. */
+    alignas(64) std::atomic<std::uint64_t> m_head;
+
+    /** The total number of bytes read from the ring. */
+    alignas(64) std::atomic<std::uint64_t> m_tail;
+
+    /** Whether the consumer is waiting for the ring to become non-empty. */
+    alignas(64) std::atomic<bool> m_isReaderWaiting;
+
+    /** Whether the producer is waiting for the ring to become non-full. */
+    alignas(64) std::atomic<bool> m_isWriterWaiting;
+  };
+
+  /** The layout at the start of a shared memory segment. */
+  struct SharedMemorySegment {
+    static constexpr auto VERSION = std::uint32_t(1);
+
+    /** The version of the layout. */
+    std::uint32_t m_version;
+
+    /** The number of bytes each ring can store. */
+    std::uint64_t m_capacity;
+
+    /** The client to server ring followed by the server to client ring. */
+    std::array<SharedMemoryRing, 2> m_rings;
+  };
+
+  /**
+   * Stores the state shared by a SharedMemoryChannel's Connection, Reader
+   * and Writer. The rings carry the data, the local socket is only used to
+   * exchange the segment's name, to wake a waiting peer and to detect when the
+   * peer goes away.
+   */
+  struct SharedMemoryEntry {
+    using Socket = boost::asio::local::stream_protocol::socket;
+    Threading::Mutex m_mutex;
+    boost::asio::io_service* m_ioService;
+    Socket m_socket;
+    boost::interprocess::mapped_region m_region;
+    std::uint64_t m_capacity;
+    SharedMemoryRing* m_inbound;
+    char* m_inboundData;
+    SharedMemoryRing* m_outbound;
+    char* m_outboundData;
+    std::atomic<bool> m_isOpen;
+    bool m_isPeerClosed;
+
+    explicit SharedMemoryEntry(boost::asio::io_service& ioService)
+      : m_ioService(&ioService),
+        m_socket(ioService),
+        m_capacity(0),
+        m_inbound(nullptr),
+        m_inboundData(nullptr),
+        m_outbound(nullptr),
+        m_outboundData(nullptr),
+        m_isOpen(false),
+        m_isPeerClosed(false) {}
+
+    /**
+     * Creates a segment and hands it to the client over the connected socket.
+     * @param capacity The number of bytes each ring can store.
+     */
+    void OpenServer(std::size_t capacity) {
+      static auto nextId = std::atomic<std::uint64_t>(0);
+      auto name = "beam_shm_" + std::to_string(::getpid()) + "_" +
+        std::to_string(++nextId);
+      auto segment = boost::interprocess::shared_memory_object(
+        boost::interprocess::create_only, name.c_str(),
+        boost::interprocess::read_write);
+      try {
+        segment.truncate(static_cast<boost::interprocess::offset_t>(
+          sizeof(SharedMemorySegment) + 2 * capacity));
+        m_region = boost::interprocess::mapped_region(segment,
+          boost::interprocess::read_write);
+        auto header = new(m_region.get_address()) SharedMemorySegment();
+        header->m_version = SharedMemorySegment::VERSION;
+        header->m_capacity = capacity;
+        Map(1);
+        auto length = static_cast<std::uint8_t>(name.size());
+        boost::asio::write(m_socket, boost::asio::buffer(&length, 1));
+        boost::asio::write(m_socket, boost::asio::buffer(name));
+        auto acknowledgement = char();
+        boost::asio::read(m_socket, boost::asio::buffer(&acknowledgement, 1));
+      } catch(const std::exception&) {
+        boost::interprocess::shared_memory_object::remove(name.c_str());
+        throw;
+      }
+      boost::interprocess::shared_memory_object::remove(name.c_str());
+      Start();
+    }
+
+    /** Maps the segment named by the server over the connected socket. */
+    void OpenClient() {
+      auto length = std::uint8_t();
+      boost::asio::read(m_socket, boost::asio::buffer(&length, 1));
+      auto name = std::string(length, '\0');
+      boost::asio::read(m_socket, boost::asio::buffer(name));
+      auto segment = boost::interprocess::shared_memory_object(
+        boost::interprocess::open_only, name.c_str(),
+        boost::interprocess::read_write);
+      m_region = boost::interprocess::mapped_region(segment,
+        boost::interprocess::read_write);
+      auto header =
+        static_cast<SharedMemorySegment*>(m_region.get_address());
+      if(m_region.get_size() < sizeof(SharedMemorySegment) ||
+          header->m_version != SharedMemorySegment::VERSION ||
+          m_region.get_size() <
+            sizeof(SharedMemorySegment) + 2 * header->m_capacity) {
+        BOOST_THROW_EXCEPTION(IO::ConnectException(
+          "Incompatible shared memory segment."));
+      }
+      Map(0);
+      auto acknowledgement = char(0);
+      boost::asio::write(m_socket, boost::asio::buffer(&acknowledgement, 1));
+      Start();
+    }
+
+    void Close() {
+      auto lock = std::lock_guard(m_mutex);
+      if(!m_isOpen) {
+        return;
+      }
+      m_isOpen = false;
+      auto errorCode = boost::system::error_code();
+      m_socket.shutdown(Socket::shutdown_both, errorCode);
+      m_socket.close(errorCode);
+    }
+
+    /** Wakes the peer if it is waiting on either ring. */
+    void Notify() {
+      auto doorbell = char(0);
+      auto errorCode = boost::system::error_code();
+      auto lock = std::lock_guard(m_mutex);
+      m_socket.write_some(boost::asio::buffer(&doorbell, 1), errorCode);
+    }
+
+    /**
+     * Suspends the current routine until a condition on a ring holds. The
+     * reader and the writer share the socket as their doorbell, so a waiter
+     * that drains it also wakes the other local waiter, which then re-tests
+     * its own condition.
+     * @param isWaiting The flag the peer tests to decide whether to notify.
+     * @param isReady Tests whether the condition being waited for holds.
+     */
+    template<typename F>
+    void Wait(std::atomic<bool>& isWaiting, const F& isReady) {
+      while(true) {
+        auto waitResult = Routines::Async<void>();
+        {
+          auto lock = std::lock_guard(m_mutex);
+          if(!m_isOpen) {
+            BOOST_THROW_EXCEPTION(IO::EndOfFileException());
+          }
+          isWaiting.store(true, std::memory_order_relaxed);
+          std::atomic_thread_fence(std::memory_order_seq_cst);
+          if(isReady()) {
+            isWaiting.store(false, std::memory_order_relaxed);
+            return;
+          }
+          if(m_isPeerClosed) {
+            BOOST_THROW_EXCEPTION(IO::EndOfFileException());
+          }
+          if(Drain()) {
+            WakeLocalWaiter();
+            continue;
+          }
+          m_socket.async_wait(Socket::wait_read, [&] (const auto& error) {
+            if(error && error != boost::asio::error::operation_aborted) {
+              waitResult.GetEval().SetException(SocketException(error.value(),
+                error.message()));
+            } else {
+              waitResult.GetEval().SetResult();
+            }
+          });
+        }
+        try {
+          waitResult.Get();
+        } catch(const std::exception&) {
+          std::throw_with_nested(IO::EndOfFileException());
+        }
+      }
+    }
+
+    /**
+     * Copies bytes into the outbound ring, waiting for space as needed.
+     * @param data The data to copy.
+     * @param size The number of bytes to copy.
+     */
+    void Push(const char* data, std::size_t size) {
+      while(size != 0) {
+        auto head = m_outbound->m_head.load(std::memory_order_relaxed);
+        auto available = m_capacity -
+          (head - m_outbound->m_tail.load(std::memory_order_acquire));
+        if(available == 0) {
+          NotifyReader();
+          Wait(m_outbound->m_isWriterWaiting, [&] {
+            return m_outbound->m_tail.load(std::memory_order_acquire) +
+              m_capacity != head;
+          });
+          continue;
+        }
+        auto count = std::min<std::uint64_t>(available, size);
+        Copy(m_outboundData + head % m_capacity, data, count);
+        m_outbound->m_head.store(head + count, std::memory_order_release);
+        data += count;
+        size -= count;
+      }
+    }
+
+    /**
+     * Copies bytes out of the inbound ring, waiting for at least one byte.
+     * @param destination Where to copy the bytes to.
+     * @param size The maximum number of bytes to copy.
+     * @return The number of bytes copied.
+     */
+    std::size_t Pop(char* destination, std::size_t size) {
+      auto tail = m_inbound->m_tail.load(std::memory_order_relaxed);
+      auto head = m_inbound->m_head.load(std::memory_order_acquire);
+      if(head == tail) {
+        Wait(m_inbound->m_isReaderWaiting, [&] {
+          return m_inbound->m_head.load(std::memory_order_acquire) != tail;
+        });
+        head = m_inbound->m_head.load(std::memory_order_acquire);
+      }
+      auto count = static_cast<std::size_t>(
+        std::min<std::uint64_t>(head - tail, size));
+      auto offset = tail % m_capacity;
+      auto leading = std::min<std::uint64_t>(count, m_capacity - offset);
+      std::memcpy(destination, m_inboundData + offset, leading);
+      std::memcpy(destination + leading, m_inboundData, count - leading);
+      m_inbound->m_tail.store(tail + count, std::memory_order_release);
+      NotifyWriter();
+      return count;
+    }
+
+    /** Returns <code>true</code> iff the inbound ring has data. */
+    bool IsDataAvailable() const {
+      return m_inbound->m_head.load(std::memory_order_acquire) !=
+        m_inbound->m_tail.load(std::memory_order_relaxed);
+    }
+
+    /** Wakes the peer if it is waiting for the outbound ring to fill. */
+    void NotifyReader() {
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if(m_outbound->m_isReaderWaiting.load(std::memory_order_relaxed) &&
+          m_outbound->m_isReaderWaiting.exchange(false)) {
+        Notify();
+      }
+    }
+
+    /** Wakes the peer if it is waiting for the inbound ring to drain. */
+    void NotifyWriter() {
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if(m_inbound->m_isWriterWaiting.load(std::memory_order_relaxed) &&
+          m_inbound->m_isWriterWaiting.exchange(false)) {
+        Notify();
+      }
+    }
+
+    void Map(int inboundIndex) {
+      auto header =
+        static_cast<SharedMemorySegment*>(m_region.get_address());
+      auto data = static_cast<char*>(m_region.get_address()) +
+        sizeof(SharedMemorySegment);
+      m_capacity = header->m_capacity;
+      m_inbound = &header->m_rings[inboundIndex];
+      m_inboundData = data + inboundIndex * m_capacity;
+      m_outbound = &header->m_rings[1 - inboundIndex];
+      m_outboundData = data + (1 - inboundIndex) * m_capacity;
+    }
+
+    void Start() {
+      auto errorCode = boost::system::error_code();
+      m_socket.non_blocking(true, errorCode);
+      if(errorCode) {
+        BOOST_THROW_EXCEPTION(SocketException(errorCode.value(),
+          errorCode.message()));
+      }
+      m_isOpen = true;
+    }
+
+    void Copy(char* destination, const char* source, std::uint64_t size) {
+      auto offset = static_cast<std::uint64_t>(
+        destination - m_outboundData);
+      auto leading = std::min(size, m_capacity - offset);
+      std::memcpy(destination, source, leading);
+      std::memcpy(m_outboundData, source + leading, size - leading);
+    }
+
+    void WakeLocalWaiter() {
+      auto errorCode = boost::system::error_code();
+      m_socket.cancel(errorCode);
+    }
+
+    bool Drain() {
+      auto isDrained = false;
+      auto buffer = std::array<char, 64>();
+      while(true) {
+        auto errorCode = boost::system::error_code();
+        auto size = m_socket.read_some(boost::asio::buffer(buffer),
+          errorCode);
+        if(errorCode == boost::asio::error::would_block ||
+            errorCode == boost::asio::error::try_again) {
+          return isDrained;
+        } else if(errorCode) {
+          m_isPeerClosed = true;
+          return true;
+        }
+        isDrained |= size != 0;
+      }
+    }
+  };
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,79 @@
+#ifndef BEAM_SHARED_MEMORY_READER_HPP
+#define BEAM_SHARED_MEMORY_READER_HPP
+#include <algorithm>
+#include <memory>
+#include "Beam/IO/Reader.hpp"
+#include "Beam/Network/Network.hpp"
+#include "Beam/Network/SharedMemoryDetails.hpp"
+
+namespace Beam {
+namespace Network {
+
+  /** Reads from the inbound ring of a shared memory Channel. */
+  class SharedMemoryReader {
+    public:
+      bool IsDataAvailable() const;
+
+      template<typename Buffer>
+      std::size_t Read(Out<Buffer> destination);
+
+      std::size_t Read(char* destination, std::size_t size);
+
+      template<typename Buffer>
+      std::size_t Read(Out<Buffer> destination, std::size_t size);
+
+    private:
+      friend class SharedMemoryChannel;
+      static constexpr auto DEFAULT_READ_SIZE = std::size_t(8 * 1024);
+      std::shared_ptr<Details::SharedMemoryEntry> m_entry;
+
+      SharedMemoryReader(std::shared_ptr<Details::SharedMemoryEntry> entry);
+      SharedMemoryReader(const SharedMemoryReader&) = delete;
+      SharedMemoryReader& operator =(const SharedMemoryReader&) = delete;
+  };
+
+  inline bool SharedMemoryReader::IsDataAvailable() const {
+    return m_entry->m_isOpen && m_entry->IsDataAvailable();
+  }
+
+  template<typename Buffer>
+  std::size_t SharedMemoryReader::Read(Out<Buffer> destination) {
+    return Read(Store(destination), DEFAULT_READ_SIZE);
+  }
+
+  inline std::size_t SharedMemoryReader::Read(char* destination,
+      std::size_t size) {
+    if(size == 0) {
+      return 0;
+    }
+    return m_entry->Pop(destination, size);
+  }
+
+  template<typename Buffer>
+  std::size_t SharedMemoryReader::Read(Out<Buffer> destination,
+      std::size_t size) {
+    auto initialSize = destination->GetSize();
+    auto readSize = std::min(DEFAULT_READ_SIZE, size);
+    destination->Grow(readSize);
+    auto result = std::size_t(0);
+    try {
+      result = Read(destination->GetMutableData() + initialSize, readSize);
+    } catch(const std::exception&) {
+      destination->Shrink(readSize);
+      throw;
+    }
+    destination->Shrink(readSize - result);
+    return result;
+  }
+
+  inline SharedMemoryReader::SharedMemoryReader(
+    std::shared_ptr<Details::SharedMemoryEntry> entry)
+    : m_entry(std::move(entry)) {}
+}
+
+  template<>
+  struct ImplementsConcept<Network::SharedMemoryReader, IO::Reader> :
+    std::true_type {};
+}
+
+#endif
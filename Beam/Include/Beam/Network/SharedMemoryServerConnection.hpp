@@ -0,0 +1,145 @@
+#ifndef BEAM_SHARED_MEMORY_SERVER_CONNECTION_HPP
+#define BEAM_SHARED_MEMORY_SERVER_CONNECTION_HPP
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/optional/optional.hpp>
+#include "Beam/IO/ConnectException.hpp"
+#include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/IO/OpenState.hpp"
+#include "Beam/IO/ServerConnection.hpp"
+#include "Beam/Network/Network.hpp"
+#include "Beam/Network/SharedMemoryChannel.hpp"
+#include "Beam/Network/SocketException.hpp"
+#include "Beam/Routines/Async.hpp"
+#include "Beam/Threading/ServiceThreadPool.hpp"
+
+namespace Beam {
+namespace Network {
+
+  /**
+   * Accepts SharedMemoryChannels from processes on the same host. Clients
+   * rendezvous through a local socket bound to a path, each accepted Channel
+   * gets its own shared memory segment.
+   */
+  class SharedMemoryServerConnection {
+    public:
+      using Channel = SharedMemoryChannel;
+
+      /** The default number of bytes each direction of a Channel buffers. */
+      static constexpr auto DEFAULT_CAPACITY = std::size_t(1024 * 1024);
+
+      /**
+       * Constructs a SharedMemoryServerConnection.
+       * @param path The path of the local socket clients connect to.
+       */
+      explicit SharedMemoryServerConnection(std::string path);
+
+      /**
+       * Constructs a SharedMemoryServerConnection.
+       * @param path The path of the local socket clients connect to.
+       * @param capacity The number of bytes each direction of a Channel
+       *        buffers.
+       */
+      SharedMemoryServerConnection(std::string path, std::size_t capacity);
+
+      ~SharedMemoryServerConnection();
+
+      std::unique_ptr<Channel> Accept();
+
+      void Close();
+
+    private:
+      std::string m_path;
+      std::size_t m_capacity;
+      boost::asio::io_service* m_ioService;
+      boost::optional<boost::asio::local::stream_protocol::acceptor>
+        m_acceptor;
+      IO::OpenState m_openState;
+
+      SharedMemoryServerConnection(
+        const SharedMemoryServerConnection&) = delete;
+      SharedMemoryServerConnection& operator =(
+        const SharedMemoryServerConnection&) = delete;
+  };
+
+  inline SharedMemoryServerConnection::SharedMemoryServerConnection(
+    std::string path)
+    : SharedMemoryServerConnection(std::move(path), DEFAULT_CAPACITY) {}
+
+  inline SharedMemoryServerConnection::SharedMemoryServerConnection(
+      std::string path, std::size_t capacity)
+      : m_path(std::move(path)),
+        m_capacity(capacity),
+        m_ioService(&Threading::ServiceThreadPool::GetInstance().GetService()) {
+    try {
+      std::remove(m_path.c_str());
+      m_acceptor.emplace(*m_ioService,
+        boost::asio::local::stream_protocol::endpoint(m_path));
+    } catch(const boost::system::system_error& e) {
+      Close();
+      try {
+        throw SocketException(e.code().value(), e.code().message());
+      } catch(const std::exception&) {
+        std::throw_with_nested(IO::ConnectException("Unable to open server."));
+      }
+    } catch(const std::exception&) {
+      Close();
+      std::throw_with_nested(IO::ConnectException("Unable to open server."));
+    }
+  }
+
+  inline SharedMemoryServerConnection::~SharedMemoryServerConnection() {
+    Close();
+  }
+
+  inline std::unique_ptr<typename SharedMemoryServerConnection::Channel>
+      SharedMemoryServerConnection::Accept() {
+    while(true) {
+      m_openState.EnsureOpen();
+      auto acceptAsync = Routines::Async<void>();
+      auto entry = std::make_shared<Details::SharedMemoryEntry>(
+        Threading::ServiceThreadPool::GetInstance().GetService());
+      m_acceptor->async_accept(entry->m_socket, [&] (const auto& error) {
+        if(error) {
+          if(error.value() == boost::system::errc::operation_canceled) {
+            acceptAsync.GetEval().SetException(IO::EndOfFileException());
+          } else {
+            acceptAsync.GetEval().SetException(SocketException(error.value(),
+              error.message()));
+          }
+        } else {
+          acceptAsync.GetEval().SetResult();
+        }
+      });
+      acceptAsync.Get();
+      try {
+        entry->OpenServer(m_capacity);
+      } catch(const std::exception&) {
+        continue;
+      }
+      return std::unique_ptr<Channel>(new SharedMemoryChannel(entry, m_path));
+    }
+  }
+
+  inline void SharedMemoryServerConnection::Close() {
+    if(m_openState.SetClosing()) {
+      return;
+    }
+    if(m_acceptor) {
+      auto errorCode = boost::system::error_code();
+      m_acceptor->close(errorCode);
+      std::remove(m_path.c_str());
+    }
+    m_openState.Close();
+  }
+}
+
+  template<>
+  struct ImplementsConcept<Network::SharedMemoryServerConnection,
+    IO::ServerConnection<Network::SharedMemoryServerConnection::Channel>> :
+    std::true_type {};
+}
+
+#endif
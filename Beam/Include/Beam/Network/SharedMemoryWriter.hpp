@@ -0,0 +1,82 @@
+#ifndef BEAM_SHARED_MEMORY_WRITER_HPP
+#define BEAM_SHARED_MEMORY_WRITER_HPP
+#include <memory>
+#include <mutex>
+#include "Beam/IO/BufferChain.hpp"
+#include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/IO/Writer.hpp"
+#include "Beam/Network/Network.hpp"
+#include "Beam/Network/SharedMemoryDetails.hpp"
+#include "Beam/Threading/Mutex.hpp"
+
+namespace Beam {
+namespace Network {
+
+  /** Writes to the outbound ring of a shared memory Channel. */
+  class SharedMemoryWriter {
+    public:
+      using Buffer = IO::SharedBuffer;
+
+      void Write(const void* data, std::size_t size);
+
+      /**
+       * Copies every segment of a BufferChain into the ring before waking the
+       * peer.
+       * @param data The data to write.
+       */
+      void Write(const IO::BufferChain& data);
+
+      template<typename BufferType>
+      void Write(const BufferType& data);
+
+    private:
+      friend class SharedMemoryChannel;
+      std::shared_ptr<Details::SharedMemoryEntry> m_entry;
+      Threading::Mutex m_mutex;
+
+      SharedMemoryWriter(std::shared_ptr<Details::SharedMemoryEntry> entry);
+      SharedMemoryWriter(const SharedMemoryWriter&) = delete;
+      SharedMemoryWriter& operator =(const SharedMemoryWriter&) = delete;
+  };
+
+  inline void SharedMemoryWriter::Write(const void* data, std::size_t size) {
+    auto lock = std::lock_guard(m_mutex);
+    if(!m_entry->m_isOpen) {
+      BOOST_THROW_EXCEPTION(IO::EndOfFileException());
+    }
+    m_entry->Push(static_cast<const char*>(data), size);
+    m_entry->NotifyReader();
+  }
+
+  inline void SharedMemoryWriter::Write(const IO::BufferChain& data) {
+    auto lock = std::lock_guard(m_mutex);
+    if(!m_entry->m_isOpen) {
+      BOOST_THROW_EXCEPTION(IO::EndOfFileException());
+    }
+    for(auto& segment : data.GetSegments()) {
+      m_entry->Push(segment.GetData(), segment.GetSize());
+    }
+    m_entry->NotifyReader();
+  }
+
+  template<typename BufferType>
+  void SharedMemoryWriter::Write(const BufferType& data) {
+    Write(data.GetData(), data.GetSize());
+  }
+
+  inline SharedMemoryWriter::SharedMemoryWriter(
+    std::shared_ptr<Details::SharedMemoryEntry> entry)
+    : m_entry(std::move(entry)) {}
+}
+
+  template<>
+  struct IO::VectoredWriteSupport<Network::SharedMemoryWriter> :
+    std::true_type {};
+
+  template<typename BufferType>
+  struct ImplementsConcept<Network::SharedMemoryWriter,
+    IO::Writer<BufferType>> : std::true_type {};
+}
+
+#endif
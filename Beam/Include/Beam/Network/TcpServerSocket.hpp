@@ -45,6 +45,12 @@ namespace Network {
 
       ~TcpServerSocket();
 
+      /**
+       * Returns the address this server is bound to, including the port
+       * assigned when binding to port 0.
+       */
+      IpAddress GetAddress() const;
+
       std::unique_ptr<Channel> Accept();
 
       void Close();
@@ -99,12 +105,18 @@ namespace Network {
     Close();
   }
 
+  inline IpAddress TcpServerSocket::GetAddress() const {
+    auto endpoint = m_acceptor->local_endpoint();
+    return IpAddress(endpoint.address().to_string(), endpoint.port());
+  }
+
   inline std::unique_ptr<typename TcpServerSocket::Channel>
       TcpServerSocket::Accept() {
     m_openState.EnsureOpen();
     auto acceptAsync = Routines::Async<void>();
     auto acceptEval = acceptAsync.GetEval();
-    auto channel = std::unique_ptr<Channel>(new TcpSocketChannel());
+    auto channel =
+      std::unique_ptr<Channel>(new TcpSocketChannel(m_options.m_shard));
     auto acceptCallback = std::function<
       void (const boost::system::error_code&)>();
     acceptCallback = [&] (const auto& error) {
@@ -131,7 +143,7 @@ namespace Network {
         channel->GetConnection().Open(m_options, {}, boost::none);
         acceptEval.SetResult();
       } catch(const std::exception&) {
-        channel.reset(new TcpSocketChannel());
+        channel.reset(new TcpSocketChannel(m_options.m_shard));
         m_acceptor->async_accept(channel->m_socket->m_socket, acceptCallback);
       }
     };
@@ -100,7 +100,7 @@ namespace Network {
       Reader m_reader;
       Writer m_writer;
 
-      TcpSocketChannel();
+      explicit TcpSocketChannel(std::size_t shard);
       TcpSocketChannel(const TcpSocketChannel&) = delete;
       TcpSocketChannel& operator =(const TcpSocketChannel&) = delete;
       void SetAddress(const IpAddress& address);
@@ -128,8 +128,8 @@ namespace Network {
   inline TcpSocketChannel::TcpSocketChannel(
     const std::vector<IpAddress>& addresses, const TcpSocketOptions& options)
     : m_socket(std::make_shared<Details::TcpSocketEntry>(
-        Threading::ServiceThreadPool::GetInstance().GetService(),
-        Threading::ServiceThreadPool::GetInstance().GetService())),
+        Threading::ServiceThreadPool::GetInstance().GetService(
+          options.m_shard))),
       m_identifier(addresses.front()),
       m_connection(m_socket, options, addresses),
       m_reader(m_socket),
@@ -143,8 +143,8 @@ namespace Network {
     const std::vector<IpAddress>& addresses, const IpAddress& interface,
     const TcpSocketOptions& options)
     : m_socket(std::make_shared<Details::TcpSocketEntry>(
-        Threading::ServiceThreadPool::GetInstance().GetService(),
-        Threading::ServiceThreadPool::GetInstance().GetService())),
+        Threading::ServiceThreadPool::GetInstance().GetService(
+          options.m_shard))),
       m_identifier(addresses.front()),
       m_connection(m_socket, options, addresses, interface),
       m_reader(m_socket),
@@ -167,10 +167,9 @@ namespace Network {
     return m_writer;
   }
 
-  inline TcpSocketChannel::TcpSocketChannel()
+  inline TcpSocketChannel::TcpSocketChannel(std::size_t shard)
     : m_socket(std::make_shared<Details::TcpSocketEntry>(
-        Threading::ServiceThreadPool::GetInstance().GetService(),
-        Threading::ServiceThreadPool::GetInstance().GetService())),
+        Threading::ServiceThreadPool::GetInstance().GetService(shard))),
       m_connection(m_socket),
       m_reader(m_socket),
       m_writer(m_socket) {}
@@ -1,5 +1,6 @@
 #ifndef BEAM_NETWORK_TCP_SOCKET_OPTIONS_HPP
 #define BEAM_NETWORK_TCP_SOCKET_OPTIONS_HPP
+#include <cstddef>
 
 namespace Beam::Network {
 
@@ -12,13 +13,20 @@ namespace Beam::Network {
     /** The size of the write buffer. */
     int m_writeBufferSize;
 
+    /**
+     * The ServiceThreadPool shard that runs the socket, or
+     * ServiceThreadPool::ANY_SHARD to assign one in round-robin order.
+     */
+    std::size_t m_shard;
+
     /** Constructs the default options. */
     TcpSocketOptions();
   };
 
   inline TcpSocketOptions::TcpSocketOptions()
     : m_noDelayEnabled(false),
-      m_writeBufferSize(8 * 1024) {}
+      m_writeBufferSize(8 * 1024),
+      m_shard(static_cast<std::size_t>(-1)) {}
 }
 
 #endif
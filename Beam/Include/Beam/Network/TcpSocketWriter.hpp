@@ -2,6 +2,7 @@
 #define BEAM_TCP_SOCKET_WRITER_HPP
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/write.hpp>
+#include "Beam/IO/BufferChain.hpp"
 #include "Beam/IO/EndOfFileException.hpp"
 #include "Beam/IO/IO.hpp"
 #include "Beam/IO/SharedBuffer.hpp"
@@ -22,6 +23,12 @@ namespace Network {
 
       void Write(const void* data, std::size_t size);
 
+      /**
+       * Writes every segment of a BufferChain using a single vectored write.
+       * @param data The data to write.
+       */
+      void Write(const IO::BufferChain& data);
+
       template<typename BufferType>
       void Write(const BufferType& data);
 
@@ -33,15 +40,34 @@ namespace Network {
       TcpSocketWriter(std::shared_ptr<Details::TcpSocketEntry> socket);
       TcpSocketWriter(const TcpSocketWriter&) = delete;
       TcpSocketWriter& operator =(const TcpSocketWriter&) = delete;
+      template<typename B>
+      void WriteBuffers(const B& buffers);
   };
 
   inline void TcpSocketWriter::Write(const void* data, std::size_t size) {
+    WriteBuffers(boost::asio::buffer(data, size));
+  }
+
+  inline void TcpSocketWriter::Write(const IO::BufferChain& data) {
+    WriteBuffers(Details::MakeBufferSequence(data));
+  }
+
+  template<typename BufferType>
+  void TcpSocketWriter::Write(const BufferType& data) {
+    Write(data.GetData(), data.GetSize());
+  }
+
+  inline TcpSocketWriter::TcpSocketWriter(
+    std::shared_ptr<Details::TcpSocketEntry> socket)
+    : m_socket(std::move(socket)) {}
+
+  template<typename B>
+  void TcpSocketWriter::WriteBuffers(const B& buffers) {
     auto writeResult = Routines::Async<void>();
     m_socket->BeginWriteOperation();
     m_tasks.Add([&] {
       auto lock = std::lock_guard(m_socket->m_mutex);
-      boost::asio::async_write(m_socket->m_socket,
-        boost::asio::buffer(data, size),
+      boost::asio::async_write(m_socket->m_socket, buffers,
         [&] (const auto& error, auto writeSize) {
           if(error) {
             writeResult.GetEval().SetException(
@@ -59,17 +85,12 @@ namespace Network {
       std::throw_with_nested(IO::EndOfFileException());
     }
   }
-
-  template<typename BufferType>
-  void TcpSocketWriter::Write(const BufferType& data) {
-    Write(data.GetData(), data.GetSize());
-  }
-
-  inline TcpSocketWriter::TcpSocketWriter(
-    std::shared_ptr<Details::TcpSocketEntry> socket)
-    : m_socket(std::move(socket)) {}
 }
 
+  template<>
+  struct IO::VectoredWriteSupport<Network::TcpSocketWriter> :
+    std::true_type {};
+
   template<typename BufferType>
   struct ImplementsConcept<Network::TcpSocketWriter, IO::Writer<BufferType>> :
     std::true_type {};
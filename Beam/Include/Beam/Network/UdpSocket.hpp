@@ -55,6 +55,9 @@ namespace Beam::Network {
       /** Returns the IpAddress to send and receive from. */
       const IpAddress& GetAddress() const;
 
+      /** Returns the local IpAddress this socket is bound to. */
+      IpAddress GetInterface() const;
+
       /** Returns the socket's receiver. */
       UdpSocketReceiver& GetReceiver();
 
@@ -84,7 +87,6 @@ namespace Beam::Network {
       const UdpSocketOptions& options)
       : m_address(address),
         m_socket(std::make_shared<Details::UdpSocketEntry>(
-          Threading::ServiceThreadPool::GetInstance().GetService(),
           Threading::ServiceThreadPool::GetInstance().GetService(),
           boost::asio::ip::udp::v4())) {
     Open(boost::none, options);
@@ -98,7 +100,6 @@ namespace Beam::Network {
       const IpAddress& interface, const UdpSocketOptions& options)
       : m_address(address),
         m_socket(std::make_shared<Details::UdpSocketEntry>(
-          Threading::ServiceThreadPool::GetInstance().GetService(),
           Threading::ServiceThreadPool::GetInstance().GetService(),
           boost::asio::ip::udp::v4())) {
     Open(interface, options);
@@ -112,6 +113,11 @@ namespace Beam::Network {
     return m_address;
   }
 
+  inline IpAddress UdpSocket::GetInterface() const {
+    auto endpoint = m_socket->m_socket.local_endpoint();
+    return IpAddress(endpoint.address().to_string(), endpoint.port());
+  }
+
   inline UdpSocketReceiver& UdpSocket::GetReceiver() {
     return *m_receiver;
   }
@@ -1,5 +1,11 @@
 #ifndef BEAM_UDP_SOCKET_RECEIVER_HPP
 #define BEAM_UDP_SOCKET_RECEIVER_HPP
+#include <algorithm>
+#include <vector>
+#ifdef __linux__
+  #include <cerrno>
+  #include <sys/socket.h>
+#endif
 #include <boost/asio/ip/udp.hpp>
 #include <boost/asio/steady_timer.hpp>
 #include "Beam/IO/EndOfFileException.hpp"
@@ -76,7 +82,21 @@ namespace Beam::Network {
       std::size_t Receive(Out<Buffer> destination, std::size_t size,
         Out<IpAddress> address);
 
+      /**
+       * Receives a batch of DatagramPackets, waiting until at least one is
+       * available.
+       * @param packets Where to append the received packets.
+       * @param maxPackets The maximum number of packets to receive.
+       * @return The number of packets received.
+       */
+      template<typename Buffer>
+      std::size_t Receive(Out<std::vector<DatagramPacket<Buffer>>> packets,
+        std::size_t maxPackets);
+
     private:
+#ifdef __linux__
+      static constexpr auto MAX_BATCH_SIZE = std::size_t(1024);
+#endif
       mutable Threading::Mutex m_mutex;
       bool m_isOpen;
       bool m_isDeadlinePending;
@@ -84,9 +104,20 @@ namespace Beam::Network {
       UdpSocketOptions m_options;
       std::shared_ptr<Details::UdpSocketEntry> m_socket;
       boost::asio::basic_waitable_timer<boost::chrono::steady_clock> m_deadline;
+#ifdef __linux__
+      std::vector<mmsghdr> m_headers;
+      std::vector<iovec> m_vectors;
+      std::vector<boost::asio::ip::udp::endpoint> m_endpoints;
+      std::vector<char> m_batchBuffer;
+#endif
 
       UdpSocketReceiver(const UdpSocketReceiver&) = delete;
       UdpSocketReceiver& operator =(const UdpSocketReceiver&) = delete;
+      bool StartDeadline();
+      template<typename Buffer>
+      std::size_t ReceiveAvailable(
+        Out<std::vector<DatagramPacket<Buffer>>> packets,
+        std::size_t maxPackets);
       void CheckDeadline(const boost::system::error_code& error);
   };
 
@@ -105,6 +136,13 @@ namespace Beam::Network {
       BOOST_THROW_EXCEPTION(SocketException(errorCode.value(),
         errorCode.message()));
     }
+#ifndef __linux__
+    m_socket->m_socket.non_blocking(true, errorCode);
+    if(errorCode) {
+      BOOST_THROW_EXCEPTION(SocketException(errorCode.value(),
+        errorCode.message()));
+    }
+#endif
   }
 
   inline UdpSocketReceiver::~UdpSocketReceiver() {
@@ -147,15 +185,7 @@ namespace Beam::Network {
           readResult.GetEval().SetResult(readSize);
         });
     }
-    auto hasTimeout = m_options.m_timeout != boost::posix_time::pos_infin;
-    if(hasTimeout) {
-      auto lock = boost::lock_guard(m_mutex);
-      m_isDeadlinePending = true;
-      m_deadline.expires_from_now(boost::chrono::microseconds{
-        m_options.m_timeout.total_microseconds()});
-      m_deadline.async_wait(std::bind(&UdpSocketReceiver::CheckDeadline, this,
-        std::placeholders::_1));
-    }
+    auto hasTimeout = StartDeadline();
     try {
       auto result = readResult.Get();
       if(hasTimeout) {
@@ -194,6 +224,156 @@ namespace Beam::Network {
     return result;
   }
 
+  template<typename Buffer>
+  std::size_t UdpSocketReceiver::Receive(
+      Out<std::vector<DatagramPacket<Buffer>>> packets,
+      std::size_t maxPackets) {
+    if(maxPackets == 0) {
+      return 0;
+    }
+    {
+      auto lock = boost::lock_guard(m_socket->m_mutex);
+      if(!m_socket->m_isOpen) {
+        BOOST_THROW_EXCEPTION(IO::EndOfFileException());
+      }
+      m_socket->m_isReadPending = true;
+    }
+    auto isWaiting = false;
+    auto hasTimeout = false;
+    try {
+      auto count = std::size_t(0);
+      while(true) {
+        auto waitResult = Routines::Async<void>();
+        {
+          auto lock = boost::lock_guard(m_socket->m_mutex);
+          count = ReceiveAvailable(Store(packets), maxPackets);
+          if(count != 0) {
+            break;
+          }
+          m_socket->m_socket.async_wait(
+            boost::asio::ip::udp::socket::wait_read, [&] (const auto& error) {
+              if(error) {
+                waitResult.GetEval().SetException(SocketException(
+                  error.value(), error.message()));
+                return;
+              }
+              waitResult.GetEval().SetResult();
+            });
+        }
+        if(!isWaiting) {
+          isWaiting = true;
+          hasTimeout = StartDeadline();
+        }
+        waitResult.Get();
+      }
+      if(hasTimeout) {
+        m_deadline.cancel();
+      }
+      m_socket->EndReadOperation();
+      return count;
+    } catch(const std::exception&) {
+      m_socket->EndReadOperation();
+      std::throw_with_nested(IO::EndOfFileException());
+    }
+  }
+
+  inline bool UdpSocketReceiver::StartDeadline() {
+    if(m_options.m_timeout == boost::posix_time::pos_infin) {
+      return false;
+    }
+    auto lock = boost::lock_guard(m_mutex);
+    m_isDeadlinePending = true;
+    m_deadline.expires_from_now(boost::chrono::microseconds{
+      m_options.m_timeout.total_microseconds()});
+    m_deadline.async_wait(std::bind(&UdpSocketReceiver::CheckDeadline, this,
+      std::placeholders::_1));
+    return true;
+  }
+
+  template<typename Buffer>
+  std::size_t UdpSocketReceiver::ReceiveAvailable(
+      Out<std::vector<DatagramPacket<Buffer>>> packets,
+      std::size_t maxPackets) {
+    if(!m_socket->m_isOpen) {
+      BOOST_THROW_EXCEPTION(IO::EndOfFileException());
+    }
+#ifdef __linux__
+    auto batchSize = std::min(maxPackets, MAX_BATCH_SIZE);
+    auto datagramSize = m_options.m_maxDatagramSize;
+    if(m_headers.size() < batchSize) {
+      m_headers.resize(batchSize);
+      m_vectors.resize(batchSize);
+      m_endpoints.resize(batchSize);
+    }
+    if(m_batchBuffer.size() < batchSize * datagramSize) {
+      m_batchBuffer.resize(batchSize * datagramSize);
+    }
+    for(auto i = std::size_t(0); i != batchSize; ++i) {
+      m_vectors[i].iov_base = m_batchBuffer.data() + i * datagramSize;
+      m_vectors[i].iov_len = datagramSize;
+      m_headers[i] = mmsghdr();
+      m_headers[i].msg_hdr.msg_name = m_endpoints[i].data();
+      m_headers[i].msg_hdr.msg_namelen =
+        static_cast<socklen_t>(m_endpoints[i].capacity());
+      m_headers[i].msg_hdr.msg_iov = &m_vectors[i];
+      m_headers[i].msg_hdr.msg_iovlen = 1;
+    }
+    auto result = ::recvmmsg(m_socket->m_socket.native_handle(),
+      m_headers.data(), static_cast<unsigned int>(batchSize), MSG_DONTWAIT,
+      nullptr);
+    if(result < 0) {
+      auto error = errno;
+      if(error == EAGAIN || error == EWOULDBLOCK || error == EINTR) {
+        return 0;
+      }
+      auto errorCode = boost::system::error_code(error,
+        boost::system::system_category());
+      BOOST_THROW_EXCEPTION(SocketException(errorCode.value(),
+        errorCode.message()));
+    }
+    auto count = static_cast<std::size_t>(result);
+    packets->reserve(packets->size() + count);
+    for(auto i = std::size_t(0); i != count; ++i) {
+      auto& endpoint = m_endpoints[i];
+      endpoint.resize(m_headers[i].msg_hdr.msg_namelen);
+      auto& packet = packets->emplace_back();
+      packet.GetData().Append(static_cast<const char*>(m_vectors[i].iov_base),
+        m_headers[i].msg_len);
+      if(i != 0 && endpoint == m_endpoints[i - 1]) {
+        packet.GetAddress() = (*packets)[packets->size() - 2].GetAddress();
+      } else {
+        packet.GetAddress() = IpAddress(endpoint.address().to_string(),
+          endpoint.port());
+      }
+    }
+    return count;
+#else
+    auto count = std::size_t(0);
+    while(count != maxPackets) {
+      auto errorCode = boost::system::error_code();
+      auto senderEndpoint = boost::asio::ip::udp::endpoint();
+      auto packet = DatagramPacket<Buffer>();
+      auto& data = packet.GetData();
+      data.Grow(m_options.m_maxDatagramSize);
+      auto size = m_socket->m_socket.receive_from(boost::asio::buffer(
+        data.GetMutableData(), m_options.m_maxDatagramSize), senderEndpoint, 0,
+        errorCode);
+      if(errorCode == boost::asio::error::would_block) {
+        break;
+      } else if(errorCode) {
+        BOOST_THROW_EXCEPTION(SocketException(errorCode.value(),
+          errorCode.message()));
+      }
+      data.Shrink(m_options.m_maxDatagramSize - size);
+      packet.GetAddress() = IpAddress(senderEndpoint.address().to_string(),
+        senderEndpoint.port());
+      packets->push_back(std::move(packet));
+      ++count;
+    }
+    return count;
+#endif
+  }
+
   inline void UdpSocketReceiver::CheckDeadline(
       const boost::system::error_code& error) {
     {
@@ -1,6 +1,13 @@
 #ifndef BEAM_UDP_SOCKET_SENDER_HPP
 #define BEAM_UDP_SOCKET_SENDER_HPP
+#include <algorithm>
+#include <vector>
+#ifdef __linux__
+  #include <cerrno>
+  #include <sys/socket.h>
+#endif
 #include <boost/asio/ip/udp.hpp>
+#include <boost/container/small_vector.hpp>
 #include "Beam/IO/EndOfFileException.hpp"
 #include "Beam/Network/DatagramPacket.hpp"
 #include "Beam/Network/Network.hpp"
@@ -39,12 +46,24 @@ namespace Beam::Network {
       void Send(const void* data, std::size_t size,
         const IpAddress& destination);
 
+      /**
+       * Sends a batch of DatagramPackets.
+       * @param packets The DatagramPackets to send.
+       */
+      template<typename Buffer>
+      void Send(const std::vector<DatagramPacket<Buffer>>& packets);
+
     private:
+#ifdef __linux__
+      static constexpr auto MAX_BATCH_SIZE = std::size_t(1024);
+      static constexpr auto INLINE_BATCH_SIZE = std::size_t(16);
+#endif
       std::shared_ptr<Details::UdpSocketEntry> m_socket;
       Threading::TaskRunner m_tasks;
 
       UdpSocketSender(const UdpSocketSender&) = delete;
       UdpSocketSender& operator =(const UdpSocketSender&) = delete;
+      void WaitWritable();
   };
 
   inline UdpSocketSender::UdpSocketSender(const UdpSocketOptions& options,
@@ -83,6 +102,92 @@ namespace Beam::Network {
       std::throw_with_nested(IO::EndOfFileException());
     }
   }
+
+  template<typename Buffer>
+  void UdpSocketSender::Send(
+      const std::vector<DatagramPacket<Buffer>>& packets) {
+#ifdef __linux__
+    if(packets.empty()) {
+      return;
+    }
+    auto endpoints = boost::container::small_vector<
+      boost::asio::ip::udp::endpoint, INLINE_BATCH_SIZE>(packets.size());
+    auto vectors =
+      boost::container::small_vector<iovec, INLINE_BATCH_SIZE>(packets.size());
+    auto headers = boost::container::small_vector<mmsghdr, INLINE_BATCH_SIZE>(
+      packets.size());
+    for(auto i = std::size_t(0); i != packets.size(); ++i) {
+      auto& packet = packets[i];
+      if(i != 0 && packet.GetAddress() == packets[i - 1].GetAddress()) {
+        endpoints[i] = endpoints[i - 1];
+      } else {
+        endpoints[i] = boost::asio::ip::udp::endpoint(
+          boost::asio::ip::address::from_string(packet.GetAddress().GetHost()),
+          packet.GetAddress().GetPort());
+      }
+      vectors[i].iov_base = const_cast<char*>(packet.GetData().GetData());
+      vectors[i].iov_len = packet.GetData().GetSize();
+      headers[i].msg_hdr.msg_name = endpoints[i].data();
+      headers[i].msg_hdr.msg_namelen =
+        static_cast<socklen_t>(endpoints[i].size());
+      headers[i].msg_hdr.msg_iov = &vectors[i];
+      headers[i].msg_hdr.msg_iovlen = 1;
+    }
+    m_socket->BeginWriteOperation();
+    try {
+      auto sent = std::size_t(0);
+      while(sent != packets.size()) {
+        auto result = 0;
+        auto error = 0;
+        {
+          auto lock = boost::lock_guard(m_socket->m_mutex);
+          if(!m_socket->m_isOpen) {
+            BOOST_THROW_EXCEPTION(IO::EndOfFileException());
+          }
+          result = ::sendmmsg(m_socket->m_socket.native_handle(),
+            headers.data() + sent, static_cast<unsigned int>(
+              std::min(packets.size() - sent, MAX_BATCH_SIZE)), MSG_DONTWAIT);
+          error = errno;
+        }
+        if(result >= 0) {
+          sent += static_cast<std::size_t>(result);
+        } else if(error == EAGAIN || error == EWOULDBLOCK) {
+          WaitWritable();
+        } else if(error != EINTR) {
+          auto errorCode = boost::system::error_code(error,
+            boost::system::system_category());
+          BOOST_THROW_EXCEPTION(SocketException(errorCode.value(),
+            errorCode.message()));
+        }
+      }
+      m_socket->EndWriteOperation();
+    } catch(const std::exception&) {
+      m_socket->EndWriteOperation();
+      std::throw_with_nested(IO::EndOfFileException());
+    }
+#else
+    for(auto& packet : packets) {
+      Send(packet);
+    }
+#endif
+  }
+
+  inline void UdpSocketSender::WaitWritable() {
+    auto waitResult = Routines::Async<void>();
+    {
+      auto lock = boost::lock_guard(m_socket->m_mutex);
+      m_socket->m_socket.async_wait(boost::asio::ip::udp::socket::wait_write,
+        [&] (const auto& error) {
+          if(error) {
+            waitResult.GetEval().SetException(SocketException(error.value(),
+              error.message()));
+            return;
+          }
+          waitResult.GetEval().SetResult();
+        });
+    }
+    waitResult.Get();
+  }
 }
 
 #endif
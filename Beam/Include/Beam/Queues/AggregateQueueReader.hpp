@@ -1,17 +1,25 @@
 #ifndef BEAM_AGGREGATE_QUEUE_READER_HPP
 #define BEAM_AGGREGATE_QUEUE_READER_HPP
 #include <atomic>
+#include <deque>
+#include <memory>
 #include <utility>
 #include <vector>
+#include <boost/thread/mutex.hpp>
 #include "Beam/Queues/Queue.hpp"
 #include "Beam/Queues/Queues.hpp"
 #include "Beam/Queues/ScopedQueueReader.hpp"
 #include "Beam/Routines/RoutineHandlerGroup.hpp"
+#include "Beam/Threading/ConditionVariable.hpp"
+#include "Beam/Threading/LockRelease.hpp"
 
 namespace Beam {
 
   /**
    * Combines multiple QueuesReaders together into a single QueueReader.
+   * QueueReaders supporting readiness callbacks are read directly by the
+   * popping Routine, serviced in round-robin order as they become ready. Any
+   * other QueueReader is drained by a dedicated Routine.
    * @param <T> The type of data to read from the QueueReader.
    */
   template<typename T>
@@ -37,59 +45,176 @@ namespace Beam {
       using QueueReader<T>::Break;
 
     private:
+      struct Entry {
+        QueueReader<Source>* m_queue;
+        bool m_isReady;
+        bool m_isFinished;
+        std::exception_ptr m_breakException;
+      };
       std::vector<ScopedQueueReader<Source>> m_queues;
-      std::atomic_int m_queueCount;
-      Queue<Source> m_destination;
+      std::shared_ptr<Queue<Source>> m_forwardQueue;
+      std::atomic_int m_forwardCount;
+      boost::mutex m_mutex;
+      Threading::ConditionVariable m_isReadyCondition;
+      std::vector<Entry> m_entries;
+      std::deque<std::size_t> m_readyEntries;
+      int m_openCount;
+      std::exception_ptr m_breakException;
       Routines::RoutineHandlerGroup m_routines;
+
+      void OnReady(std::size_t index, const std::exception_ptr& e);
+      boost::optional<Source> Poll(boost::unique_lock<boost::mutex>& lock);
   };
 
   template<typename T>
   AggregateQueueReader<T>::AggregateQueueReader(
       std::vector<ScopedQueueReader<T>> queues)
       : m_queues(std::move(queues)),
-        m_queueCount(static_cast<int>(m_queues.size())) {
-    if(m_queueCount == 0) {
-      Break();
-    } else {
-      for(auto& queue : m_queues) {
+        m_forwardQueue(std::make_shared<Queue<Source>>()),
+        m_forwardCount(0),
+        m_openCount(0) {
+    auto forwardQueues = std::vector<ScopedQueueReader<Source>*>();
+    for(auto& queue : m_queues) {
+      m_entries.push_back({&queue, false, false, nullptr});
+    }
+    m_entries.push_back({m_forwardQueue.get(), false, true, nullptr});
+    for(auto i = std::size_t(0); i != m_queues.size(); ++i) {
+      ++m_openCount;
+      if(!m_queues[i].SetReadinessCallback(
+          [=] (const std::exception_ptr& e) {
+            OnReady(i, e);
+          })) {
+        m_entries[i].m_isFinished = true;
+        --m_openCount;
+        forwardQueues.push_back(&m_queues[i]);
+      }
+    }
+    if(!forwardQueues.empty()) {
+      m_entries.back().m_isFinished = false;
+      ++m_openCount;
+      m_forwardQueue->SetReadinessCallback(
+        [=, index = m_entries.size() - 1] (const std::exception_ptr& e) {
+          OnReady(index, e);
+        });
+      m_forwardCount = static_cast<int>(forwardQueues.size());
+      for(auto queue : forwardQueues) {
         m_routines.Spawn(
-          [=, queue = &queue] {
+          [=] {
             try {
               while(true) {
-                m_destination.Push(queue->Pop());
+                m_forwardQueue->Push(queue->Pop());
               }
             } catch(const std::exception&) {
-              if(m_queueCount.fetch_sub(1) == 1) {
-                m_destination.Break(std::current_exception());
+              if(m_forwardCount.fetch_sub(1) == 1) {
+                m_forwardQueue->Break(std::current_exception());
               }
             }
           });
       }
     }
+    if(m_openCount == 0) {
+      Break();
+    }
   }
 
   template<typename T>
   AggregateQueueReader<T>::~AggregateQueueReader() {
     Break();
+    m_routines.Wait();
+    for(auto& queue : m_queues) {
+      queue.SetReadinessCallback(nullptr);
+    }
+    m_forwardQueue->SetReadinessCallback(nullptr);
   }
 
   template<typename T>
   typename AggregateQueueReader<T>::Source AggregateQueueReader<T>::Pop() {
-    return m_destination.Pop();
+    auto lock = boost::unique_lock(m_mutex);
+    while(true) {
+      while(m_readyEntries.empty() && m_openCount != 0) {
+        m_isReadyCondition.wait(lock);
+      }
+      if(m_readyEntries.empty()) {
+        std::rethrow_exception(m_breakException);
+      }
+      if(auto value = Poll(lock)) {
+        return std::move(*value);
+      }
+    }
   }
 
   template<typename T>
   boost::optional<typename AggregateQueueReader<T>::Source>
       AggregateQueueReader<T>::TryPop() {
-    return m_destination.TryPop();
+    auto lock = boost::unique_lock(m_mutex);
+    while(!m_readyEntries.empty()) {
+      if(auto value = Poll(lock)) {
+        return value;
+      }
+    }
+    return boost::none;
   }
 
   template<typename T>
   void AggregateQueueReader<T>::Break(const std::exception_ptr& e) {
+    {
+      auto lock = boost::lock_guard(m_mutex);
+      if(!m_breakException) {
+        m_breakException = e;
+      }
+    }
     for(auto& queue : m_queues) {
       queue.Break(e);
     }
-    m_destination.Break(e);
+    m_forwardQueue->Break(e);
+  }
+
+  template<typename T>
+  void AggregateQueueReader<T>::OnReady(
+      std::size_t index, const std::exception_ptr& e) {
+    auto lock = boost::lock_guard(m_mutex);
+    auto& entry = m_entries[index];
+    if(entry.m_isFinished) {
+      return;
+    }
+    if(e) {
+      entry.m_breakException = e;
+    }
+    if(!entry.m_isReady) {
+      entry.m_isReady = true;
+      m_readyEntries.push_back(index);
+      m_isReadyCondition.notify_one();
+    }
+  }
+
+  template<typename T>
+  boost::optional<typename AggregateQueueReader<T>::Source>
+      AggregateQueueReader<T>::Poll(boost::unique_lock<boost::mutex>& lock) {
+    auto index = m_readyEntries.front();
+    m_readyEntries.pop_front();
+    auto& entry = m_entries[index];
+    entry.m_isReady = false;
+    auto value = [&] {
+      auto release = Threading::Release(lock);
+      return entry.m_queue->TryPop();
+    }();
+    if(value) {
+      if(!entry.m_isReady) {
+        entry.m_isReady = true;
+        m_readyEntries.push_back(index);
+        m_isReadyCondition.notify_one();
+      }
+    } else if(entry.m_breakException && !entry.m_isReady) {
+      entry.m_isFinished = true;
+      --m_openCount;
+      if(!m_breakException) {
+        m_breakException = entry.m_breakException;
+      }
+      if(m_openCount == 0) {
+        m_isReadyCondition.notify_all();
+      }
+    }
+    return value;
   }
 }
 
@@ -0,0 +1,292 @@
+#ifndef BEAM_BOUNDED_QUEUE_HPP
+#define BEAM_BOUNDED_QUEUE_HPP
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include "Beam/Queues/AbstractQueue.hpp"
+#include "Beam/Queues/OverflowPolicy.hpp"
+#include "Beam/Queues/PipeBrokenException.hpp"
+#include "Beam/Queues/Queues.hpp"
+#include "Beam/Threading/ConditionVariable.hpp"
+
+namespace Beam {
+
+  /**
+   * Implements a Queue holding at most a fixed number of values, applying an
+   * OverflowPolicy when a value is pushed onto a full queue.
+   * @param <T> The data to store in the Queue.
+   */
+  template<typename T>
+  class BoundedQueue : public AbstractQueue<T> {
+    public:
+      using Target = typename AbstractQueue<T>::Target;
+      using Source = typename AbstractQueue<T>::Source;
+
+      /**
+       * Constructs a BoundedQueue.
+       * @param capacity The maximum number of values the queue can hold.
+       * @param policy How to handle pushing onto a full queue.
+       */
+      BoundedQueue(std::size_t capacity, OverflowPolicy policy);
+
+      /** Returns the maximum number of values the queue can hold. */
+      std::size_t GetCapacity() const;
+
+      /** Returns the OverflowPolicy applied when the queue is full. */
+      OverflowPolicy GetPolicy() const;
+
+      /** Returns the number of values currently in the queue. */
+      std::size_t GetSize() const;
+
+      /** Returns the largest number of values the queue has held at once. */
+      std::size_t GetHighWaterMark() const;
+
+      /** Returns the number of values discarded due to overflow. */
+      std::uint64_t GetDropCount() const;
+
+      /** Returns <code>true</code> iff this Queue is broken. */
+      bool IsBroken() const;
+
+      Source Pop() override;
+
+      boost::optional<Source> TryPop() override;
+
+      void PopAll(Out<std::vector<Source>> values) override;
+
+      bool TryPopAll(Out<std::vector<Source>> values) override;
+
+      bool SetReadinessCallback(
+        std::function<void (const std::exception_ptr&)> callback) override;
+
+      void Push(const Target& value) override;
+
+      void Push(Target&& value) override;
+
+      void Break(const std::exception_ptr& exception) override;
+
+      using QueueWriter<T>::Break;
+
+    private:
+      mutable boost::mutex m_mutex;
+      Threading::ConditionVariable m_isAvailableCondition;
+      Threading::ConditionVariable m_isSpaceAvailableCondition;
+      std::size_t m_capacity;
+      OverflowPolicy m_policy;
+      std::deque<T> m_queue;
+      std::size_t m_highWaterMark;
+      std::uint64_t m_dropCount;
+      int m_waitingCount;
+      std::exception_ptr m_breakException;
+      std::function<void (const std::exception_ptr&)> m_readinessCallback;
+
+      bool UnlockedIsAvailable() const;
+      void UnlockedWait(boost::unique_lock<boost::mutex>& lock);
+      template<typename V>
+      void Emplace(V&& value);
+      void UnlockedNotifyWriters(std::size_t previousSize);
+  };
+
+  template<typename T>
+  BoundedQueue<T>::BoundedQueue(std::size_t capacity, OverflowPolicy policy)
+    : m_capacity(std::max<std::size_t>(capacity, 1)),
+      m_policy(policy),
+      m_highWaterMark(0),
+      m_dropCount(0),
+      m_waitingCount(0) {}
+
+  template<typename T>
+  std::size_t BoundedQueue<T>::GetCapacity() const {
+    return m_capacity;
+  }
+
+  template<typename T>
+  OverflowPolicy BoundedQueue<T>::GetPolicy() const {
+    return m_policy;
+  }
+
+  template<typename T>
+  std::size_t BoundedQueue<T>::GetSize() const {
+    auto lock = boost::lock_guard(m_mutex);
+    return m_queue.size();
+  }
+
+  template<typename T>
+  std::size_t BoundedQueue<T>::GetHighWaterMark() const {
+    auto lock = boost::lock_guard(m_mutex);
+    return m_highWaterMark;
+  }
+
+  template<typename T>
+  std::uint64_t BoundedQueue<T>::GetDropCount() const {
+    auto lock = boost::lock_guard(m_mutex);
+    return m_dropCount;
+  }
+
+  template<typename T>
+  bool BoundedQueue<T>::IsBroken() const {
+    auto lock = boost::lock_guard(m_mutex);
+    return m_breakException != nullptr && m_queue.empty();
+  }
+
+  template<typename T>
+  typename BoundedQueue<T>::Source BoundedQueue<T>::Pop() {
+    auto lock = boost::unique_lock(m_mutex);
+    while(!UnlockedIsAvailable()) {
+      UnlockedWait(lock);
+    }
+    if(m_queue.empty()) {
+      std::rethrow_exception(m_breakException);
+    }
+    auto value = std::move(m_queue.front());
+    m_queue.pop_front();
+    UnlockedNotifyWriters(m_queue.size() + 1);
+    return value;
+  }
+
+  template<typename T>
+  boost::optional<typename BoundedQueue<T>::Source> BoundedQueue<T>::TryPop() {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_queue.empty()) {
+      return boost::none;
+    }
+    auto value = std::move(m_queue.front());
+    m_queue.pop_front();
+    UnlockedNotifyWriters(m_queue.size() + 1);
+    return value;
+  }
+
+  template<typename T>
+  void BoundedQueue<T>::PopAll(Out<std::vector<Source>> values) {
+    auto lock = boost::unique_lock(m_mutex);
+    while(!UnlockedIsAvailable()) {
+      UnlockedWait(lock);
+    }
+    if(m_queue.empty()) {
+      std::rethrow_exception(m_breakException);
+    }
+    auto size = m_queue.size();
+    values->insert(values->end(), std::make_move_iterator(m_queue.begin()),
+      std::make_move_iterator(m_queue.end()));
+    m_queue.clear();
+    UnlockedNotifyWriters(size);
+  }
+
+  template<typename T>
+  bool BoundedQueue<T>::TryPopAll(Out<std::vector<Source>> values) {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_queue.empty()) {
+      return false;
+    }
+    auto size = m_queue.size();
+    values->insert(values->end(), std::make_move_iterator(m_queue.begin()),
+      std::make_move_iterator(m_queue.end()));
+    m_queue.clear();
+    UnlockedNotifyWriters(size);
+    return true;
+  }
+
+  template<typename T>
+  bool BoundedQueue<T>::SetReadinessCallback(
+      std::function<void (const std::exception_ptr&)> callback) {
+    auto lock = boost::lock_guard(m_mutex);
+    m_readinessCallback = std::move(callback);
+    if(m_readinessCallback && !m_queue.empty()) {
+      m_readinessCallback(nullptr);
+    }
+    if(m_readinessCallback && m_breakException) {
+      m_readinessCallback(m_breakException);
+    }
+    return true;
+  }
+
+  template<typename T>
+  void BoundedQueue<T>::Push(const Target& value) {
+    Emplace(value);
+  }
+
+  template<typename T>
+  void BoundedQueue<T>::Push(Target&& value) {
+    Emplace(std::move(value));
+  }
+
+  template<typename T>
+  void BoundedQueue<T>::Break(const std::exception_ptr& exception) {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_breakException != nullptr) {
+      return;
+    }
+    m_breakException = exception;
+    m_isAvailableCondition.notify_all();
+    m_isSpaceAvailableCondition.notify_all();
+    if(m_readinessCallback) {
+      m_readinessCallback(m_breakException);
+    }
+  }
+
+  template<typename T>
+  void BoundedQueue<T>::UnlockedWait(boost::unique_lock<boost::mutex>& lock) {
+    ++m_waitingCount;
+    m_isAvailableCondition.wait(lock);
+    --m_waitingCount;
+  }
+
+  template<typename T>
+  bool BoundedQueue<T>::UnlockedIsAvailable() const {
+    return !m_queue.empty() || m_breakException;
+  }
+
+  template<typename T>
+  template<typename V>
+  void BoundedQueue<T>::Emplace(V&& value) {
+    auto lock = boost::unique_lock(m_mutex);
+    if(m_breakException != nullptr) {
+      std::rethrow_exception(m_breakException);
+    }
+    if(m_queue.size() >= m_capacity) {
+      if(m_policy == OverflowPolicy::BLOCK) {
+        while(m_queue.size() >= m_capacity && !m_breakException) {
+          m_isSpaceAvailableCondition.wait(lock);
+        }
+        if(m_breakException != nullptr) {
+          std::rethrow_exception(m_breakException);
+        }
+      } else if(m_policy == OverflowPolicy::DROP_OLDEST) {
+        m_queue.pop_front();
+        ++m_dropCount;
+      } else if(m_policy == OverflowPolicy::DROP_NEWEST) {
+        ++m_dropCount;
+        return;
+      } else {
+        m_breakException = std::make_exception_ptr(
+          PipeBrokenException("Queue overflow."));
+        m_isAvailableCondition.notify_all();
+        m_isSpaceAvailableCondition.notify_all();
+        if(m_readinessCallback) {
+          m_readinessCallback(m_breakException);
+        }
+        std::rethrow_exception(m_breakException);
+      }
+    }
+    m_queue.push_back(std::forward<V>(value));
+    m_highWaterMark = std::max(m_highWaterMark, m_queue.size());
+    if(m_waitingCount != 0) {
+      m_isAvailableCondition.notify_one();
+    }
+    if(m_queue.size() == 1 && m_readinessCallback) {
+      m_readinessCallback(nullptr);
+    }
+  }
+
+  template<typename T>
+  void BoundedQueue<T>::UnlockedNotifyWriters(std::size_t previousSize) {
+    if(m_policy == OverflowPolicy::BLOCK && previousSize >= m_capacity) {
+      m_isSpaceAvailableCondition.notify_all();
+    }
+  }
+}
+
+#endif
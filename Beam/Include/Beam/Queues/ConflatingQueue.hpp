@@ -0,0 +1,231 @@
+#ifndef BEAM_CONFLATING_QUEUE_HPP
+#define BEAM_CONFLATING_QUEUE_HPP
+#include <deque>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include "Beam/Queues/AbstractQueue.hpp"
+#include "Beam/Queues/PipeBrokenException.hpp"
+#include "Beam/Queues/Queues.hpp"
+#include "Beam/Threading/ConditionVariable.hpp"
+#include "Beam/Utilities/KeyValuePair.hpp"
+
+namespace Beam {
+
+  /**
+   * Stores only the most recent value pushed for each key, popping keys in
+   * the order they first arrived.
+   * @param <K> The type of key.
+   * @param <V> The type of value associated with each key.
+   */
+  template<typename K, typename V>
+  class ConflatingQueue : public AbstractQueue<KeyValuePair<K, V>> {
+    public:
+      using Target = typename AbstractQueue<KeyValuePair<K, V>>::Target;
+      using Source = typename AbstractQueue<KeyValuePair<K, V>>::Source;
+
+      /** The type of key. */
+      using Key = K;
+
+      /** The type of value associated with each key. */
+      using Value = V;
+
+      /** Constructs a ConflatingQueue. */
+      ConflatingQueue();
+
+      /** Returns the number of keys with a pending value. */
+      std::size_t GetSize() const;
+
+      /** Returns <code>true</code> iff this Queue is broken. */
+      bool IsBroken() const;
+
+      Source Pop() override;
+
+      boost::optional<Source> TryPop() override;
+
+      void PopAll(Out<std::vector<Source>> values) override;
+
+      bool TryPopAll(Out<std::vector<Source>> values) override;
+
+      bool SetReadinessCallback(
+        std::function<void (const std::exception_ptr&)> callback) override;
+
+      void Push(const Target& value) override;
+
+      void Push(Target&& value) override;
+
+      void Break(const std::exception_ptr& exception) override;
+
+      using QueueWriter<KeyValuePair<K, V>>::Break;
+
+    private:
+      mutable boost::mutex m_mutex;
+      Threading::ConditionVariable m_isAvailableCondition;
+      std::deque<Key> m_keys;
+      std::unordered_map<Key, Value> m_values;
+      int m_waitingCount;
+      std::exception_ptr m_breakException;
+      std::function<void (const std::exception_ptr&)> m_readinessCallback;
+
+      bool UnlockedIsAvailable() const;
+      void UnlockedWait(boost::unique_lock<boost::mutex>& lock);
+      Source UnlockedPop();
+      void UnlockedPopAll(std::vector<Source>& values);
+      template<typename T>
+      void Emplace(T&& value);
+  };
+
+  template<typename K, typename V>
+  ConflatingQueue<K, V>::ConflatingQueue()
+    : m_waitingCount(0) {}
+
+  template<typename K, typename V>
+  std::size_t ConflatingQueue<K, V>::GetSize() const {
+    auto lock = boost::lock_guard(m_mutex);
+    return m_keys.size();
+  }
+
+  template<typename K, typename V>
+  bool ConflatingQueue<K, V>::IsBroken() const {
+    auto lock = boost::lock_guard(m_mutex);
+    return m_breakException != nullptr && m_keys.empty();
+  }
+
+  template<typename K, typename V>
+  typename ConflatingQueue<K, V>::Source ConflatingQueue<K, V>::Pop() {
+    auto lock = boost::unique_lock(m_mutex);
+    while(!UnlockedIsAvailable()) {
+      UnlockedWait(lock);
+    }
+    if(m_keys.empty()) {
+      std::rethrow_exception(m_breakException);
+    }
+    return UnlockedPop();
+  }
+
+  template<typename K, typename V>
+  boost::optional<typename ConflatingQueue<K, V>::Source>
+      ConflatingQueue<K, V>::TryPop() {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_keys.empty()) {
+      return boost::none;
+    }
+    return UnlockedPop();
+  }
+
+  template<typename K, typename V>
+  void ConflatingQueue<K, V>::PopAll(Out<std::vector<Source>> values) {
+    auto lock = boost::unique_lock(m_mutex);
+    while(!UnlockedIsAvailable()) {
+      UnlockedWait(lock);
+    }
+    if(m_keys.empty()) {
+      std::rethrow_exception(m_breakException);
+    }
+    UnlockedPopAll(*values);
+  }
+
+  template<typename K, typename V>
+  bool ConflatingQueue<K, V>::TryPopAll(Out<std::vector<Source>> values) {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_keys.empty()) {
+      return false;
+    }
+    UnlockedPopAll(*values);
+    return true;
+  }
+
+  template<typename K, typename V>
+  bool ConflatingQueue<K, V>::SetReadinessCallback(
+      std::function<void (const std::exception_ptr&)> callback) {
+    auto lock = boost::lock_guard(m_mutex);
+    m_readinessCallback = std::move(callback);
+    if(m_readinessCallback && !m_keys.empty()) {
+      m_readinessCallback(nullptr);
+    }
+    if(m_readinessCallback && m_breakException) {
+      m_readinessCallback(m_breakException);
+    }
+    return true;
+  }
+
+  template<typename K, typename V>
+  void ConflatingQueue<K, V>::Push(const Target& value) {
+    Emplace(value);
+  }
+
+  template<typename K, typename V>
+  void ConflatingQueue<K, V>::Push(Target&& value) {
+    Emplace(std::move(value));
+  }
+
+  template<typename K, typename V>
+  void ConflatingQueue<K, V>::Break(const std::exception_ptr& exception) {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_breakException != nullptr) {
+      return;
+    }
+    m_breakException = exception;
+    m_isAvailableCondition.notify_all();
+    if(m_readinessCallback) {
+      m_readinessCallback(m_breakException);
+    }
+  }
+
+  template<typename K, typename V>
+  void ConflatingQueue<K, V>::UnlockedWait(
+      boost::unique_lock<boost::mutex>& lock) {
+    ++m_waitingCount;
+    m_isAvailableCondition.wait(lock);
+    --m_waitingCount;
+  }
+
+  template<typename K, typename V>
+  bool ConflatingQueue<K, V>::UnlockedIsAvailable() const {
+    return !m_keys.empty() || m_breakException;
+  }
+
+  template<typename K, typename V>
+  typename ConflatingQueue<K, V>::Source ConflatingQueue<K, V>::UnlockedPop() {
+    auto node = m_values.extract(m_keys.front());
+    m_keys.pop_front();
+    return Source(std::move(node.key()), std::move(node.mapped()));
+  }
+
+  template<typename K, typename V>
+  void ConflatingQueue<K, V>::UnlockedPopAll(std::vector<Source>& values) {
+    values.reserve(values.size() + m_keys.size());
+    for(auto& key : m_keys) {
+      auto value = m_values.find(key);
+      values.emplace_back(std::move(key), std::move(value->second));
+    }
+    m_keys.clear();
+    m_values.clear();
+  }
+
+  template<typename K, typename V>
+  template<typename T>
+  void ConflatingQueue<K, V>::Emplace(T&& value) {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_breakException != nullptr) {
+      std::rethrow_exception(m_breakException);
+    }
+    auto entry = m_values.find(value.m_key);
+    if(entry != m_values.end()) {
+      entry->second = std::forward<T>(value).m_value;
+      return;
+    }
+    m_keys.push_back(value.m_key);
+    m_values.emplace(std::forward<T>(value).m_key,
+      std::forward<T>(value).m_value);
+    if(m_waitingCount != 0) {
+      m_isAvailableCondition.notify_one();
+    }
+    if(m_keys.size() == 1 && m_readinessCallback) {
+      m_readinessCallback(nullptr);
+    }
+  }
+}
+
+#endif
@@ -2,6 +2,7 @@
 #define BEAM_CONVERTER_QUEUE_READER_HPP
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "Beam/Pointers/Dereference.hpp"
 #include "Beam/Queues/Queues.hpp"
 #include "Beam/Queues/ScopedQueueReader.hpp"
@@ -42,6 +43,13 @@ namespace Beam {
 
       boost::optional<Source> TryPop() override;
 
+      void PopAll(Out<std::vector<Source>> values) override;
+
+      bool TryPopAll(Out<std::vector<Source>> values) override;
+
+      bool SetReadinessCallback(
+        std::function<void (const std::exception_ptr&)> callback) override;
+
       void Break(const std::exception_ptr& e) override;
 
       using QueueReader<std::invoke_result_t<C, const T&>>::Break;
@@ -49,6 +57,8 @@ namespace Beam {
     private:
       ScopedQueueReader<T> m_source;
       Converter m_converter;
+
+      void Convert(std::vector<T>& sources, std::vector<Source>& values);
   };
 
   template<typename QueueReader, typename C>
@@ -90,10 +100,43 @@ namespace Beam {
     return boost::none;
   }
 
+  template<typename T, typename C>
+  void ConverterQueueReader<T, C>::PopAll(Out<std::vector<Source>> values) {
+    auto sources = std::vector<T>();
+    m_source.PopAll(Store(sources));
+    Convert(sources, *values);
+  }
+
+  template<typename T, typename C>
+  bool ConverterQueueReader<T, C>::TryPopAll(
+      Out<std::vector<Source>> values) {
+    auto sources = std::vector<T>();
+    if(!m_source.TryPopAll(Store(sources))) {
+      return false;
+    }
+    Convert(sources, *values);
+    return true;
+  }
+
+  template<typename T, typename C>
+  bool ConverterQueueReader<T, C>::SetReadinessCallback(
+      std::function<void (const std::exception_ptr&)> callback) {
+    return m_source.SetReadinessCallback(std::move(callback));
+  }
+
   template<typename T, typename C>
   void ConverterQueueReader<T, C>::Break(const std::exception_ptr& e) {
     m_source.Break(e);
   }
+
+  template<typename T, typename C>
+  void ConverterQueueReader<T, C>::Convert(std::vector<T>& sources,
+      std::vector<Source>& values) {
+    values.reserve(values.size() + sources.size());
+    for(auto& source : sources) {
+      values.push_back(m_converter(std::move(source)));
+    }
+  }
 }
 
 #endif
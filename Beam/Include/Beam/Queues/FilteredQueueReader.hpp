@@ -2,6 +2,7 @@
 #define BEAM_FILTERED_QUEUE_READER_HPP
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "Beam/Pointers/Dereference.hpp"
 #include "Beam/Queues/Queues.hpp"
 #include "Beam/Queues/ScopedQueueReader.hpp"
@@ -37,6 +38,13 @@ namespace Beam {
 
       boost::optional<Source> TryPop() override;
 
+      void PopAll(Out<std::vector<Source>> values) override;
+
+      bool TryPopAll(Out<std::vector<Source>> values) override;
+
+      bool SetReadinessCallback(
+        std::function<void (const std::exception_ptr&)> callback) override;
+
       void Break(const std::exception_ptr& e) override;
 
       using QueueReader<T>::Break;
@@ -44,6 +52,8 @@ namespace Beam {
     private:
       ScopedQueueReader<Source> m_source;
       Filter m_filter;
+
+      bool Apply(std::vector<Source>& sources, std::vector<Source>& values);
   };
 
   template<typename QueueReader, typename F>
@@ -93,10 +103,52 @@ namespace Beam {
     }
   }
 
+  template<typename T, typename F>
+  void FilteredQueueReader<T, F>::PopAll(Out<std::vector<Source>> values) {
+    auto sources = std::vector<Source>();
+    while(true) {
+      m_source.PopAll(Store(sources));
+      if(Apply(sources, *values)) {
+        return;
+      }
+      sources.clear();
+    }
+  }
+
+  template<typename T, typename F>
+  bool FilteredQueueReader<T, F>::TryPopAll(Out<std::vector<Source>> values) {
+    auto sources = std::vector<Source>();
+    while(m_source.TryPopAll(Store(sources))) {
+      if(Apply(sources, *values)) {
+        return true;
+      }
+      sources.clear();
+    }
+    return false;
+  }
+
+  template<typename T, typename F>
+  bool FilteredQueueReader<T, F>::SetReadinessCallback(
+      std::function<void (const std::exception_ptr&)> callback) {
+    return m_source.SetReadinessCallback(std::move(callback));
+  }
+
   template<typename T, typename F>
   void FilteredQueueReader<T, F>::Break(const std::exception_ptr& e) {
     m_source.Break(e);
   }
+
+  template<typename T, typename F>
+  bool FilteredQueueReader<T, F>::Apply(std::vector<Source>& sources,
+      std::vector<Source>& values) {
+    auto size = values.size();
+    for(auto& source : sources) {
+      if(m_filter(source)) {
+        values.push_back(std::move(source));
+      }
+    }
+    return values.size() != size;
+  }
 }
 
 #endif
@@ -0,0 +1,289 @@
+#ifndef BEAM_MPSC_QUEUE_HPP
+#define BEAM_MPSC_QUEUE_HPP
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include "Beam/Queues/AbstractQueue.hpp"
+#include "Beam/Queues/PipeBrokenException.hpp"
+#include "Beam/Queues/Queues.hpp"
+#include "Beam/Threading/ConditionVariable.hpp"
+
+namespace Beam {
+
+  /**
+   * Implements a bounded lock-free Queue for multiple writers and a single
+   * reader. Pushing onto a full queue or popping from an empty one suspends
+   * the current Routine.
+   * @param <T> The data to store in the Queue.
+   */
+  template<typename T>
+  class MpscQueue : public AbstractQueue<T> {
+    public:
+      using Target = typename AbstractQueue<T>::Target;
+      using Source = typename AbstractQueue<T>::Source;
+
+      /** The default number of values the queue can hold. */
+      static constexpr auto DEFAULT_CAPACITY = std::size_t(1024);
+
+      /** Constructs an MpscQueue with the default capacity. */
+      MpscQueue();
+
+      /**
+       * Constructs an MpscQueue.
+       * @param capacity The minimum number of values the queue can hold,
+       *        rounded up to a power of two.
+       */
+      explicit MpscQueue(std::size_t capacity);
+
+      ~MpscQueue() override;
+
+      /** Returns the number of values the queue can hold. */
+      std::size_t GetCapacity() const;
+
+      /** Returns <code>true</code> iff this Queue is broken. */
+      bool IsBroken() const;
+
+      Source Pop() override;
+
+      boost::optional<Source> TryPop() override;
+
+      void PopAll(Out<std::vector<Source>> values) override;
+
+      bool TryPopAll(Out<std::vector<Source>> values) override;
+
+      void Push(const Target& value) override;
+
+      void Push(Target&& value) override;
+
+      void Break(const std::exception_ptr& exception) override;
+
+      using QueueWriter<T>::Break;
+
+    private:
+      struct Cell {
+        std::atomic_size_t m_sequence;
+        std::aligned_storage_t<sizeof(T), alignof(T)> m_value;
+      };
+      std::size_t m_mask;
+      std::unique_ptr<Cell[]> m_cells;
+      alignas(64) std::atomic_size_t m_head;
+      alignas(64) std::atomic_size_t m_tail;
+      alignas(64) std::atomic_bool m_isBroken;
+      std::atomic_bool m_isReaderWaiting;
+      std::atomic_bool m_isWriterWaiting;
+      boost::mutex m_mutex;
+      Threading::ConditionVariable m_isAvailableCondition;
+      Threading::ConditionVariable m_isSpaceAvailableCondition;
+      std::exception_ptr m_breakException;
+
+      static T& Get(Cell& cell);
+      bool IsAvailable() const;
+      template<typename V>
+      void Emplace(V&& value);
+      void Wait();
+      void NotifyWriters();
+  };
+
+  template<typename T>
+  MpscQueue<T>::MpscQueue()
+    : MpscQueue(DEFAULT_CAPACITY) {}
+
+  template<typename T>
+  MpscQueue<T>::MpscQueue(std::size_t capacity)
+      : m_head(0),
+        m_tail(0),
+        m_isBroken(false),
+        m_isReaderWaiting(false),
+        m_isWriterWaiting(false) {
+    auto size = std::size_t(2);
+    while(size < capacity) {
+      size <<= 1;
+    }
+    m_mask = size - 1;
+    m_cells = std::make_unique<Cell[]>(size);
+    for(auto i = std::size_t(0); i != size; ++i) {
+      m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  template<typename T>
+  MpscQueue<T>::~MpscQueue() {
+    while(TryPop()) {}
+  }
+
+  template<typename T>
+  std::size_t MpscQueue<T>::GetCapacity() const {
+    return m_mask + 1;
+  }
+
+  template<typename T>
+  bool MpscQueue<T>::IsBroken() const {
+    return m_isBroken.load() && !IsAvailable();
+  }
+
+  template<typename T>
+  typename MpscQueue<T>::Source MpscQueue<T>::Pop() {
+    while(true) {
+      if(auto value = TryPop()) {
+        return std::move(*value);
+      }
+      Wait();
+    }
+  }
+
+  template<typename T>
+  boost::optional<typename MpscQueue<T>::Source> MpscQueue<T>::TryPop() {
+    auto head = m_head.load(std::memory_order_relaxed);
+    auto& cell = m_cells[head & m_mask];
+    if(cell.m_sequence.load(std::memory_order_acquire) != head + 1) {
+      return boost::none;
+    }
+    auto& slot = Get(cell);
+    auto value = boost::optional<Source>(std::move(slot));
+    slot.~T();
+    m_head.store(head + 1, std::memory_order_relaxed);
+    cell.m_sequence.store(head + m_mask + 1, std::memory_order_release);
+    NotifyWriters();
+    return value;
+  }
+
+  template<typename T>
+  void MpscQueue<T>::PopAll(Out<std::vector<Source>> values) {
+    while(!TryPopAll(Store(values))) {
+      Wait();
+    }
+  }
+
+  template<typename T>
+  bool MpscQueue<T>::TryPopAll(Out<std::vector<Source>> values) {
+    auto head = m_head.load(std::memory_order_relaxed);
+    auto start = head;
+    while(head - start <= m_mask) {
+      auto& cell = m_cells[head & m_mask];
+      if(cell.m_sequence.load(std::memory_order_acquire) != head + 1) {
+        break;
+      }
+      auto& slot = Get(cell);
+      values->push_back(std::move(slot));
+      slot.~T();
+      m_head.store(head + 1, std::memory_order_relaxed);
+      cell.m_sequence.store(head + m_mask + 1, std::memory_order_release);
+      ++head;
+    }
+    if(head == start) {
+      return false;
+    }
+    NotifyWriters();
+    return true;
+  }
+
+  template<typename T>
+  void MpscQueue<T>::Push(const Target& value) {
+    Emplace(value);
+  }
+
+  template<typename T>
+  void MpscQueue<T>::Push(Target&& value) {
+    Emplace(std::move(value));
+  }
+
+  template<typename T>
+  void MpscQueue<T>::Break(const std::exception_ptr& exception) {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_isBroken.load(std::memory_order_relaxed)) {
+      return;
+    }
+    m_breakException = exception;
+    m_isBroken.store(true);
+    m_isAvailableCondition.notify_all();
+    m_isSpaceAvailableCondition.notify_all();
+  }
+
+  template<typename T>
+  T& MpscQueue<T>::Get(Cell& cell) {
+    return *std::launder(reinterpret_cast<T*>(&cell.m_value));
+  }
+
+  template<typename T>
+  bool MpscQueue<T>::IsAvailable() const {
+    auto head = m_head.load(std::memory_order_relaxed);
+    return m_cells[head & m_mask].m_sequence.load() == head + 1;
+  }
+
+  template<typename T>
+  template<typename V>
+  void MpscQueue<T>::Emplace(V&& value) {
+    if(m_isBroken.load(std::memory_order_acquire)) {
+      std::rethrow_exception(m_breakException);
+    }
+    auto tail = m_tail.load(std::memory_order_relaxed);
+    while(true) {
+      auto& cell = m_cells[tail & m_mask];
+      auto sequence = cell.m_sequence.load(std::memory_order_acquire);
+      auto difference = static_cast<std::intptr_t>(sequence - tail);
+      if(difference == 0) {
+        if(m_tail.compare_exchange_weak(tail, tail + 1,
+            std::memory_order_relaxed)) {
+          new(&cell.m_value) T(std::forward<V>(value));
+          cell.m_sequence.store(tail + 1, std::memory_order_release);
+          break;
+        }
+      } else if(difference < 0) {
+        auto lock = boost::unique_lock(m_mutex);
+        while(true) {
+          m_isWriterWaiting.store(true);
+          if(cell.m_sequence.load() == tail ||
+              m_tail.load(std::memory_order_relaxed) != tail ||
+              m_isBroken.load()) {
+            break;
+          }
+          m_isSpaceAvailableCondition.wait(lock);
+        }
+        if(m_isBroken.load(std::memory_order_relaxed)) {
+          std::rethrow_exception(m_breakException);
+        }
+        tail = m_tail.load(std::memory_order_relaxed);
+      } else {
+        tail = m_tail.load(std::memory_order_relaxed);
+      }
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(m_isReaderWaiting.load(std::memory_order_relaxed)) {
+      auto lock = boost::lock_guard(m_mutex);
+      m_isReaderWaiting.store(false, std::memory_order_relaxed);
+      m_isAvailableCondition.notify_all();
+    }
+  }
+
+  template<typename T>
+  void MpscQueue<T>::Wait() {
+    auto lock = boost::unique_lock(m_mutex);
+    while(true) {
+      m_isReaderWaiting.store(true);
+      if(IsAvailable() || m_isBroken.load()) {
+        break;
+      }
+      m_isAvailableCondition.wait(lock);
+    }
+    m_isReaderWaiting.store(false, std::memory_order_relaxed);
+    if(!IsAvailable()) {
+      std::rethrow_exception(m_breakException);
+    }
+  }
+
+  template<typename T>
+  void MpscQueue<T>::NotifyWriters() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(m_isWriterWaiting.load(std::memory_order_relaxed)) {
+      auto lock = boost::lock_guard(m_mutex);
+      m_isWriterWaiting.store(false, std::memory_order_relaxed);
+      m_isSpaceAvailableCondition.notify_all();
+    }
+  }
+}
+
+#endif
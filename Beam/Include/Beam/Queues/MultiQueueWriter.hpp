@@ -26,6 +26,13 @@ namespace Beam {
 
       boost::optional<Source> TryPop() override;
 
+      void PopAll(Out<std::vector<Source>> values) override;
+
+      bool TryPopAll(Out<std::vector<Source>> values) override;
+
+      bool SetReadinessCallback(
+        std::function<void (const std::exception_ptr&)> callback) override;
+
       void Break(const std::exception_ptr& e) override;
 
       void Push(const Target& value) override;
@@ -58,6 +65,22 @@ namespace Beam {
     return m_queue.TryPop();
   }
 
+  template<typename T>
+  void MultiQueueWriter<T>::PopAll(Out<std::vector<Source>> values) {
+    m_queue.PopAll(Store(values));
+  }
+
+  template<typename T>
+  bool MultiQueueWriter<T>::TryPopAll(Out<std::vector<Source>> values) {
+    return m_queue.TryPopAll(Store(values));
+  }
+
+  template<typename T>
+  bool MultiQueueWriter<T>::SetReadinessCallback(
+      std::function<void (const std::exception_ptr&)> callback) {
+    return m_queue.SetReadinessCallback(std::move(callback));
+  }
+
   template<typename T>
   void MultiQueueWriter<T>::Break(const std::exception_ptr& e) {
     m_callbacks.Break(e);
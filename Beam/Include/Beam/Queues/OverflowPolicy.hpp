@@ -0,0 +1,39 @@
+#ifndef BEAM_OVERFLOW_POLICY_HPP
+#define BEAM_OVERFLOW_POLICY_HPP
+#include <ostream>
+#include "Beam/Queues/Queues.hpp"
+
+namespace Beam {
+
+  /** Enumerates the ways a bounded queue handles a push when it is full. */
+  enum class OverflowPolicy {
+
+    /** Suspends the pushing Routine until space is available. */
+    BLOCK,
+
+    /** Discards the oldest value in the queue to make room. */
+    DROP_OLDEST,
+
+    /** Discards the value being pushed. */
+    DROP_NEWEST,
+
+    /** Breaks the queue and throws to the pushing Routine. */
+    BREAK
+  };
+
+  inline std::ostream& operator <<(std::ostream& out, OverflowPolicy policy) {
+    if(policy == OverflowPolicy::BLOCK) {
+      return out << "BLOCK";
+    } else if(policy == OverflowPolicy::DROP_OLDEST) {
+      return out << "DROP_OLDEST";
+    } else if(policy == OverflowPolicy::DROP_NEWEST) {
+      return out << "DROP_NEWEST";
+    } else if(policy == OverflowPolicy::BREAK) {
+      return out << "BREAK";
+    } else {
+      return out << "NONE";
+    }
+  }
+}
+
+#endif
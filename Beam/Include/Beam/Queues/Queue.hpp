@@ -1,6 +1,9 @@
 #ifndef BEAM_QUEUE_HPP
 #define BEAM_QUEUE_HPP
 #include <deque>
+#include <functional>
+#include <iterator>
+#include <vector>
 #include <boost/thread/mutex.hpp>
 #include "Beam/Queues/AbstractQueue.hpp"
 #include "Beam/Queues/PipeBrokenException.hpp"
@@ -21,7 +24,7 @@ namespace Beam {
       using Source = typename AbstractQueue<T>::Source;
 
       /** Constructs a Queue. */
-      Queue() = default;
+      Queue();
 
       /** Returns <code>true</code> iff this Queue is broken. */
       bool IsBroken() const;
@@ -30,6 +33,13 @@ namespace Beam {
 
       boost::optional<Source> TryPop() override;
 
+      void PopAll(Out<std::vector<Source>> values) override;
+
+      bool TryPopAll(Out<std::vector<Source>> values) override;
+
+      bool SetReadinessCallback(
+        std::function<void (const std::exception_ptr&)> callback) override;
+
       void Push(const Target& value) override;
 
       void Push(Target&& value) override;
@@ -42,11 +52,20 @@ namespace Beam {
       mutable boost::mutex m_mutex;
       mutable Threading::ConditionVariable m_isAvailableCondition;
       std::deque<T> m_queue;
+      int m_waitingCount;
       std::exception_ptr m_breakException;
+      std::function<void (const std::exception_ptr&)> m_readinessCallback;
 
       bool UnlockedIsAvailable() const;
+      void UnlockedWait(boost::unique_lock<boost::mutex>& lock);
+      void UnlockedNotify();
+      void UnlockedPopAll(std::vector<Source>& values);
   };
 
+  template<typename T>
+  Queue<T>::Queue()
+    : m_waitingCount(0) {}
+
   template<typename T>
   bool Queue<T>::IsBroken() const {
     auto lock = boost::lock_guard(m_mutex);
@@ -57,7 +76,7 @@ namespace Beam {
   typename Queue<T>::Source Queue<T>::Pop() {
     auto lock = boost::unique_lock(m_mutex);
     while(!UnlockedIsAvailable()) {
-      m_isAvailableCondition.wait(lock);
+      UnlockedWait(lock);
     }
     if(m_queue.empty()) {
       std::rethrow_exception(m_breakException);
@@ -78,6 +97,42 @@ namespace Beam {
     return value;
   }
 
+  template<typename T>
+  void Queue<T>::PopAll(Out<std::vector<Source>> values) {
+    auto lock = boost::unique_lock(m_mutex);
+    while(!UnlockedIsAvailable()) {
+      UnlockedWait(lock);
+    }
+    if(m_queue.empty()) {
+      std::rethrow_exception(m_breakException);
+    }
+    UnlockedPopAll(*values);
+  }
+
+  template<typename T>
+  bool Queue<T>::TryPopAll(Out<std::vector<Source>> values) {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_queue.empty()) {
+      return false;
+    }
+    UnlockedPopAll(*values);
+    return true;
+  }
+
+  template<typename T>
+  bool Queue<T>::SetReadinessCallback(
+      std::function<void (const std::exception_ptr&)> callback) {
+    auto lock = boost::lock_guard(m_mutex);
+    m_readinessCallback = std::move(callback);
+    if(m_readinessCallback && !m_queue.empty()) {
+      m_readinessCallback(nullptr);
+    }
+    if(m_readinessCallback && m_breakException) {
+      m_readinessCallback(m_breakException);
+    }
+    return true;
+  }
+
   template<typename T>
   void Queue<T>::Push(const Target& value) {
     auto lock = boost::lock_guard(m_mutex);
@@ -85,9 +140,7 @@ namespace Beam {
       std::rethrow_exception(m_breakException);
     }
     m_queue.push_back(value);
-    if(m_queue.size() == 1) {
-      m_isAvailableCondition.notify_one();
-    }
+    UnlockedNotify();
   }
 
   template<typename T>
@@ -97,9 +150,7 @@ namespace Beam {
       std::rethrow_exception(m_breakException);
     }
     m_queue.push_back(std::move(value));
-    if(m_queue.size() == 1) {
-      m_isAvailableCondition.notify_one();
-    }
+    UnlockedNotify();
   }
 
   template<typename T>
@@ -110,12 +161,39 @@ namespace Beam {
     }
     m_breakException = exception;
     m_isAvailableCondition.notify_all();
+    if(m_readinessCallback) {
+      m_readinessCallback(m_breakException);
+    }
   }
 
   template<typename T>
   bool Queue<T>::UnlockedIsAvailable() const {
     return !m_queue.empty() || m_breakException;
   }
+
+  template<typename T>
+  void Queue<T>::UnlockedWait(boost::unique_lock<boost::mutex>& lock) {
+    ++m_waitingCount;
+    m_isAvailableCondition.wait(lock);
+    --m_waitingCount;
+  }
+
+  template<typename T>
+  void Queue<T>::UnlockedNotify() {
+    if(m_waitingCount != 0) {
+      m_isAvailableCondition.notify_one();
+    }
+    if(m_queue.size() == 1 && m_readinessCallback) {
+      m_readinessCallback(nullptr);
+    }
+  }
+
+  template<typename T>
+  void Queue<T>::UnlockedPopAll(std::vector<Source>& values) {
+    values.insert(values.end(), std::make_move_iterator(m_queue.begin()),
+      std::make_move_iterator(m_queue.end()));
+    m_queue.clear();
+  }
 }
 
 #endif
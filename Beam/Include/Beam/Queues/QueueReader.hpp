@@ -1,6 +1,9 @@
 #ifndef BEAM_QUEUE_READER_HPP
 #define BEAM_QUEUE_READER_HPP
+#include <exception>
+#include <functional>
 #include <type_traits>
+#include <vector>
 #include <boost/optional/optional.hpp>
 #include "Beam/Pointers/Dereference.hpp"
 #include "Beam/Pointers/Out.hpp"
@@ -31,6 +34,32 @@ namespace Beam {
        * without blocking, otherwise returns <i>boost::none</i>.
        */
       virtual boost::optional<Source> TryPop() = 0;
+
+      /**
+       * Pops every value available in the queue, blocking until at least one
+       * value is available.
+       * @param values Stores the popped values in the order they were pushed.
+       */
+      virtual void PopAll(Out<std::vector<Source>> values);
+
+      /**
+       * Pops every value available in the queue without blocking.
+       * @param values Stores the popped values in the order they were pushed.
+       * @return <code>true</code> iff at least one value was popped.
+       */
+      virtual bool TryPopAll(Out<std::vector<Source>> values);
+
+      /**
+       * Sets a callback invoked when a value is pushed onto the empty queue
+       * and when the queue is broken, allowing a single reader to wait on
+       * many queues at once. The callback may be spurious and is invoked
+       * while the queue is locked, so it must not access the queue.
+       * @param callback The callback to invoke, passed the exception that
+       *        broke the queue or <code>nullptr</code> when a value arrives.
+       * @return <code>true</code> iff this queue supports readiness callbacks.
+       */
+      virtual bool SetReadinessCallback(
+        std::function<void (const std::exception_ptr&)> callback);
   };
 
   /**
@@ -72,6 +101,27 @@ namespace Beam {
       breakCallback(std::current_exception());
     }
   }
+
+  template<typename T>
+  void QueueReader<T>::PopAll(Out<std::vector<Source>> values) {
+    values->push_back(Pop());
+    TryPopAll(Store(values));
+  }
+
+  template<typename T>
+  bool QueueReader<T>::TryPopAll(Out<std::vector<Source>> values) {
+    auto size = values->size();
+    while(auto value = TryPop()) {
+      values->push_back(std::move(*value));
+    }
+    return values->size() != size;
+  }
+
+  template<typename T>
+  bool QueueReader<T>::SetReadinessCallback(
+      std::function<void (const std::exception_ptr&)> callback) {
+    return false;
+  }
 }
 
 #endif
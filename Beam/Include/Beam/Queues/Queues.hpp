@@ -6,13 +6,17 @@ namespace Beam {
   template<typename T> class AggregateQueueReader;
   class BasePublisher;
   class BaseQueue;
+  template<typename T> class BoundedQueue;
   class CallbackQueue;
   template<typename T, typename C, typename B> class CallbackQueueWriter;
+  template<typename K, typename V> class ConflatingQueue;
   template<typename T, typename C> class ConverterQueueReader;
   template<typename T, typename C> class ConverterQueueWriter;
   template<typename T, typename F> class FilteredQueueReader;
   template<typename T, typename F> class FilteredQueueWriter;
+  template<typename T> class MpscQueue;
   template<typename T> class MultiQueueWriter;
+  enum class OverflowPolicy;
   class PipeBrokenException;
   template<typename T> class Publisher;
   template<typename T> class Queue;
@@ -25,7 +29,9 @@ namespace Beam {
   template<typename T, typename Q> class ScopedQueueReader;
   template<typename T, typename Q> class ScopedQueueWriter;
   template<typename T, typename S> class SequencePublisher;
+  template<typename K, typename H> class ShardedTaskQueue;
   template<typename T, typename S> class SnapshotPublisher;
+  template<typename T> class SpscQueue;
   template<typename T> class StatePublisher;
   template<typename T> class StateQueue;
   template<typename K, typename V> class TablePublisher;
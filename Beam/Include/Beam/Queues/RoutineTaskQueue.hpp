@@ -1,5 +1,6 @@
 #ifndef BEAM_ROUTINE_TASK_QUEUE_HPP
 #define BEAM_ROUTINE_TASK_QUEUE_HPP
+#include <type_traits>
 #include "Beam/Queues/Queues.hpp"
 #include "Beam/Queues/TaskQueue.hpp"
 #include "Beam/Routines/RoutineHandler.hpp"
@@ -56,6 +57,14 @@ namespace Beam {
       /** Waits for this queue to be broken and all tasks to complete. */
       void Wait();
 
+      /**
+       * Pushes a callable without wrapping it in a <i>std::function</i>.
+       * @param task The callable to push.
+       */
+      template<typename F, typename = std::enable_if_t<
+        !std::is_same_v<std::decay_t<F>, Target>>>
+      void Push(F&& task);
+
       void Push(const Target& value) override;
 
       void Push(Target&& value) override;
@@ -104,6 +113,11 @@ namespace Beam {
     m_routine.Wait();
   }
 
+  template<typename F, typename>
+  void RoutineTaskQueue::Push(F&& task) {
+    m_tasks.Push(std::forward<F>(task));
+  }
+
   inline void RoutineTaskQueue::Push(const Target& value) {
     m_tasks.Push(value);
   }
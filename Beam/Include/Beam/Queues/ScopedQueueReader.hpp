@@ -45,6 +45,13 @@ namespace Beam {
 
       boost::optional<Source> TryPop() override;
 
+      void PopAll(Out<std::vector<Source>> values) override;
+
+      bool TryPopAll(Out<std::vector<Source>> values) override;
+
+      bool SetReadinessCallback(
+        std::function<void (const std::exception_ptr&)> callback) override;
+
       void Break(const std::exception_ptr& e) override;
 
       ScopedQueueReader& operator =(ScopedQueueReader&& queue);
@@ -97,6 +104,22 @@ namespace Beam {
     return m_queue->TryPop();
   }
 
+  template<typename T, typename Q>
+  void ScopedQueueReader<T, Q>::PopAll(Out<std::vector<Source>> values) {
+    m_queue->PopAll(Store(values));
+  }
+
+  template<typename T, typename Q>
+  bool ScopedQueueReader<T, Q>::TryPopAll(Out<std::vector<Source>> values) {
+    return m_queue->TryPopAll(Store(values));
+  }
+
+  template<typename T, typename Q>
+  bool ScopedQueueReader<T, Q>::SetReadinessCallback(
+      std::function<void (const std::exception_ptr&)> callback) {
+    return m_queue->SetReadinessCallback(std::move(callback));
+  }
+
   template<typename T, typename Q>
   void ScopedQueueReader<T, Q>::Break(const std::exception_ptr& e) {
     if(m_queue) {
@@ -0,0 +1,173 @@
+#ifndef BEAM_SHARDED_TASK_QUEUE_HPP
+#define BEAM_SHARDED_TASK_QUEUE_HPP
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <boost/throw_exception.hpp>
+#include "Beam/Queues/PipeBrokenException.hpp"
+#include "Beam/Queues/Queues.hpp"
+#include "Beam/Queues/TaskQueue.hpp"
+#include "Beam/Routines/RoutineHandler.hpp"
+#include "Beam/Routines/Scheduler.hpp"
+
+namespace Beam {
+
+  /**
+   * Runs pushed tasks across multiple Routines, such that tasks pushed with
+   * the same key run in the order they were pushed while tasks with different
+   * keys may run in parallel.
+   * @param <K> The type of key used to order tasks.
+   * @param <H> The hash function used to assign a key to a shard.
+   */
+  template<typename K, typename H = std::hash<K>>
+  class ShardedTaskQueue {
+    public:
+
+      /** The type of key used to order tasks. */
+      using Key = K;
+
+      /** The hash function used to assign a key to a shard. */
+      using Hash = H;
+
+      /** Constructs a ShardedTaskQueue with one shard per Scheduler thread. */
+      ShardedTaskQueue();
+
+      /**
+       * Constructs a ShardedTaskQueue.
+       * @param shardCount The number of shards, each run by its own Routine.
+       */
+      explicit ShardedTaskQueue(std::size_t shardCount);
+
+      ~ShardedTaskQueue();
+
+      /** Returns the number of shards. */
+      std::size_t GetShardCount() const;
+
+      /** Returns the shard a key is assigned to. */
+      std::size_t GetShard(const Key& key) const;
+
+      /**
+       * Returns the number of tasks pushed onto a shard that have yet to
+       * start running.
+       * @param shard The index of the shard.
+       */
+      std::size_t GetDepth(std::size_t shard) const;
+
+      /**
+       * Pushes a task, throwing a PipeBrokenException if this queue has been
+       * broken.
+       * @param key The key used to order the task.
+       * @param task The task to run.
+       */
+      template<typename F>
+      void Push(const Key& key, F&& task);
+
+      /** Waits for this queue to be broken and all tasks to complete. */
+      void Wait();
+
+      /**
+       * Breaks every shard, running all tasks pushed so far. Once this
+       * returns, any subsequent Push throws.
+       */
+      void Break();
+
+    private:
+      struct Shard {
+        TaskQueue m_tasks;
+        std::atomic_size_t m_depth;
+        Routines::RoutineHandler m_routine;
+
+        explicit Shard(std::size_t contextId);
+      };
+      Hash m_hash;
+      std::atomic_bool m_isBroken;
+      std::vector<std::unique_ptr<Shard>> m_shards;
+
+      ShardedTaskQueue(const ShardedTaskQueue&) = delete;
+      ShardedTaskQueue& operator =(const ShardedTaskQueue&) = delete;
+  };
+
+  template<typename K, typename H>
+  ShardedTaskQueue<K, H>::Shard::Shard(std::size_t contextId)
+    : m_depth(0),
+      m_routine(SpawnTaskRoutine(&m_tasks, contextId)) {}
+
+  template<typename K, typename H>
+  ShardedTaskQueue<K, H>::ShardedTaskQueue()
+    : ShardedTaskQueue(
+        Routines::Details::Scheduler::GetInstance().GetThreadCount()) {}
+
+  template<typename K, typename H>
+  ShardedTaskQueue<K, H>::ShardedTaskQueue(std::size_t shardCount)
+      : m_isBroken(false) {
+    auto threadCount =
+      Routines::Details::Scheduler::GetInstance().GetThreadCount();
+    shardCount = std::max<std::size_t>(shardCount, 1);
+    m_shards.reserve(shardCount);
+    for(auto i = std::size_t(0); i != shardCount; ++i) {
+      m_shards.push_back(std::make_unique<Shard>(i % threadCount));
+    }
+  }
+
+  template<typename K, typename H>
+  ShardedTaskQueue<K, H>::~ShardedTaskQueue() {
+    Break();
+  }
+
+  template<typename K, typename H>
+  std::size_t ShardedTaskQueue<K, H>::GetShardCount() const {
+    return m_shards.size();
+  }
+
+  template<typename K, typename H>
+  std::size_t ShardedTaskQueue<K, H>::GetShard(const Key& key) const {
+    return m_hash(key) % m_shards.size();
+  }
+
+  template<typename K, typename H>
+  std::size_t ShardedTaskQueue<K, H>::GetDepth(std::size_t shard) const {
+    return m_shards[shard]->m_depth.load(std::memory_order_relaxed);
+  }
+
+  template<typename K, typename H>
+  template<typename F>
+  void ShardedTaskQueue<K, H>::Push(const Key& key, F&& task) {
+    if(m_isBroken.load()) {
+      BOOST_THROW_EXCEPTION(PipeBrokenException());
+    }
+    auto& shard = *m_shards[GetShard(key)];
+    shard.m_depth.fetch_add(1, std::memory_order_relaxed);
+    try {
+      shard.m_tasks.Push(
+        [depth = &shard.m_depth, task = std::forward<F>(task)] () mutable {
+          depth->fetch_sub(1, std::memory_order_relaxed);
+          task();
+        });
+    } catch(const std::exception&) {
+      shard.m_depth.fetch_sub(1, std::memory_order_relaxed);
+      throw;
+    }
+  }
+
+  template<typename K, typename H>
+  void ShardedTaskQueue<K, H>::Wait() {
+    for(auto& shard : m_shards) {
+      shard->m_routine.Wait();
+    }
+  }
+
+  template<typename K, typename H>
+  void ShardedTaskQueue<K, H>::Break() {
+    if(m_isBroken.exchange(true)) {
+      return;
+    }
+    for(auto& shard : m_shards) {
+      shard->m_tasks.Break();
+    }
+  }
+}
+
+#endif
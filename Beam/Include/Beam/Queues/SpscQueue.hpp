@@ -0,0 +1,257 @@
+#ifndef BEAM_SPSC_QUEUE_HPP
+#define BEAM_SPSC_QUEUE_HPP
+#include <atomic>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include "Beam/Queues/AbstractQueue.hpp"
+#include "Beam/Queues/PipeBrokenException.hpp"
+#include "Beam/Queues/Queues.hpp"
+#include "Beam/Threading/ConditionVariable.hpp"
+
+namespace Beam {
+
+  /**
+   * Implements a bounded lock-free Queue for a single writer and a single
+   * reader. Pushing onto a full queue or popping from an empty one suspends
+   * the current Routine.
+   * @param <T> The data to store in the Queue.
+   */
+  template<typename T>
+  class SpscQueue : public AbstractQueue<T> {
+    public:
+      using Target = typename AbstractQueue<T>::Target;
+      using Source = typename AbstractQueue<T>::Source;
+
+      /** The default number of values the queue can hold. */
+      static constexpr auto DEFAULT_CAPACITY = std::size_t(1024);
+
+      /** Constructs an SpscQueue with the default capacity. */
+      SpscQueue();
+
+      /**
+       * Constructs an SpscQueue.
+       * @param capacity The minimum number of values the queue can hold,
+       *        rounded up to a power of two.
+       */
+      explicit SpscQueue(std::size_t capacity);
+
+      ~SpscQueue() override;
+
+      /** Returns the number of values the queue can hold. */
+      std::size_t GetCapacity() const;
+
+      /** Returns <code>true</code> iff this Queue is broken. */
+      bool IsBroken() const;
+
+      Source Pop() override;
+
+      boost::optional<Source> TryPop() override;
+
+      void PopAll(Out<std::vector<Source>> values) override;
+
+      bool TryPopAll(Out<std::vector<Source>> values) override;
+
+      void Push(const Target& value) override;
+
+      void Push(Target&& value) override;
+
+      void Break(const std::exception_ptr& exception) override;
+
+      using QueueWriter<T>::Break;
+
+    private:
+      using Storage = std::aligned_storage_t<sizeof(T), alignof(T)>;
+      std::size_t m_mask;
+      std::unique_ptr<Storage[]> m_values;
+      alignas(64) std::atomic_size_t m_head;
+      alignas(64) std::atomic_size_t m_tail;
+      alignas(64) std::atomic_bool m_isBroken;
+      std::atomic_bool m_isReaderWaiting;
+      std::atomic_bool m_isWriterWaiting;
+      boost::mutex m_mutex;
+      Threading::ConditionVariable m_isAvailableCondition;
+      Threading::ConditionVariable m_isSpaceAvailableCondition;
+      std::exception_ptr m_breakException;
+
+      T& Get(std::size_t index);
+      template<typename V>
+      void Emplace(V&& value);
+      void Wait();
+      void NotifyWriters();
+  };
+
+  template<typename T>
+  SpscQueue<T>::SpscQueue()
+    : SpscQueue(DEFAULT_CAPACITY) {}
+
+  template<typename T>
+  SpscQueue<T>::SpscQueue(std::size_t capacity)
+      : m_head(0),
+        m_tail(0),
+        m_isBroken(false),
+        m_isReaderWaiting(false),
+        m_isWriterWaiting(false) {
+    auto size = std::size_t(1);
+    while(size < capacity) {
+      size <<= 1;
+    }
+    m_mask = size - 1;
+    m_values = std::make_unique<Storage[]>(size);
+  }
+
+  template<typename T>
+  SpscQueue<T>::~SpscQueue() {
+    for(auto i = m_head.load(); i != m_tail.load(); ++i) {
+      Get(i).~T();
+    }
+  }
+
+  template<typename T>
+  std::size_t SpscQueue<T>::GetCapacity() const {
+    return m_mask + 1;
+  }
+
+  template<typename T>
+  bool SpscQueue<T>::IsBroken() const {
+    return m_isBroken.load() && m_head.load() == m_tail.load();
+  }
+
+  template<typename T>
+  typename SpscQueue<T>::Source SpscQueue<T>::Pop() {
+    while(true) {
+      if(auto value = TryPop()) {
+        return std::move(*value);
+      }
+      Wait();
+    }
+  }
+
+  template<typename T>
+  boost::optional<typename SpscQueue<T>::Source> SpscQueue<T>::TryPop() {
+    auto head = m_head.load(std::memory_order_relaxed);
+    if(head == m_tail.load(std::memory_order_acquire)) {
+      return boost::none;
+    }
+    auto& slot = Get(head);
+    auto value = boost::optional<Source>(std::move(slot));
+    slot.~T();
+    m_head.store(head + 1, std::memory_order_release);
+    NotifyWriters();
+    return value;
+  }
+
+  template<typename T>
+  void SpscQueue<T>::PopAll(Out<std::vector<Source>> values) {
+    while(!TryPopAll(Store(values))) {
+      Wait();
+    }
+  }
+
+  template<typename T>
+  bool SpscQueue<T>::TryPopAll(Out<std::vector<Source>> values) {
+    auto head = m_head.load(std::memory_order_relaxed);
+    auto tail = m_tail.load(std::memory_order_acquire);
+    if(head == tail) {
+      return false;
+    }
+    values->reserve(values->size() + (tail - head));
+    for(auto i = head; i != tail; ++i) {
+      auto& slot = Get(i);
+      values->push_back(std::move(slot));
+      slot.~T();
+      m_head.store(i + 1, std::memory_order_release);
+    }
+    NotifyWriters();
+    return true;
+  }
+
+  template<typename T>
+  void SpscQueue<T>::Push(const Target& value) {
+    Emplace(value);
+  }
+
+  template<typename T>
+  void SpscQueue<T>::Push(Target&& value) {
+    Emplace(std::move(value));
+  }
+
+  template<typename T>
+  void SpscQueue<T>::Break(const std::exception_ptr& exception) {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_isBroken.load(std::memory_order_relaxed)) {
+      return;
+    }
+    m_breakException = exception;
+    m_isBroken.store(true);
+    m_isAvailableCondition.notify_all();
+    m_isSpaceAvailableCondition.notify_all();
+  }
+
+  template<typename T>
+  T& SpscQueue<T>::Get(std::size_t index) {
+    return *std::launder(reinterpret_cast<T*>(&m_values[index & m_mask]));
+  }
+
+  template<typename T>
+  template<typename V>
+  void SpscQueue<T>::Emplace(V&& value) {
+    if(m_isBroken.load(std::memory_order_acquire)) {
+      std::rethrow_exception(m_breakException);
+    }
+    auto tail = m_tail.load(std::memory_order_relaxed);
+    if(tail - m_head.load(std::memory_order_acquire) > m_mask) {
+      auto lock = boost::unique_lock(m_mutex);
+      while(true) {
+        m_isWriterWaiting.store(true);
+        if(tail - m_head.load() <= m_mask || m_isBroken.load()) {
+          break;
+        }
+        m_isSpaceAvailableCondition.wait(lock);
+      }
+      m_isWriterWaiting.store(false, std::memory_order_relaxed);
+      if(m_isBroken.load(std::memory_order_relaxed)) {
+        std::rethrow_exception(m_breakException);
+      }
+    }
+    new(&m_values[tail & m_mask]) T(std::forward<V>(value));
+    m_tail.store(tail + 1, std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(m_isReaderWaiting.load(std::memory_order_relaxed)) {
+      auto lock = boost::lock_guard(m_mutex);
+      m_isReaderWaiting.store(false, std::memory_order_relaxed);
+      m_isAvailableCondition.notify_all();
+    }
+  }
+
+  template<typename T>
+  void SpscQueue<T>::Wait() {
+    auto lock = boost::unique_lock(m_mutex);
+    while(true) {
+      m_isReaderWaiting.store(true);
+      if(m_head.load(std::memory_order_relaxed) != m_tail.load() ||
+          m_isBroken.load()) {
+        break;
+      }
+      m_isAvailableCondition.wait(lock);
+    }
+    m_isReaderWaiting.store(false, std::memory_order_relaxed);
+    if(m_head.load(std::memory_order_relaxed) == m_tail.load()) {
+      std::rethrow_exception(m_breakException);
+    }
+  }
+
+  template<typename T>
+  void SpscQueue<T>::NotifyWriters() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(m_isWriterWaiting.load(std::memory_order_relaxed)) {
+      auto lock = boost::lock_guard(m_mutex);
+      m_isWriterWaiting.store(false, std::memory_order_relaxed);
+      m_isSpaceAvailableCondition.notify_all();
+    }
+  }
+}
+
+#endif
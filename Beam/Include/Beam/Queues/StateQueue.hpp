@@ -1,5 +1,7 @@
 #ifndef BEAM_STATE_QUEUE_HPP
 #define BEAM_STATE_QUEUE_HPP
+#include <functional>
+#include <vector>
 #include <boost/optional/optional.hpp>
 #include <boost/thread/mutex.hpp>
 #include "Beam/Queues/AbstractQueue.hpp"
@@ -29,6 +31,13 @@ namespace Beam {
 
       boost::optional<Source> TryPop() override;
 
+      void PopAll(Out<std::vector<Source>> values) override;
+
+      bool TryPopAll(Out<std::vector<Source>> values) override;
+
+      bool SetReadinessCallback(
+        std::function<void (const std::exception_ptr&)> callback) override;
+
       void Push(const Target& value) override;
 
       void Push(Target&& value) override;
@@ -42,6 +51,7 @@ namespace Beam {
       mutable Threading::ConditionVariable m_isAvailableCondition;
       boost::optional<Target> m_value;
       std::exception_ptr m_breakException;
+      std::function<void (const std::exception_ptr&)> m_readinessCallback;
 
       bool UnlockedIsAvailable() const;
   };
@@ -83,6 +93,36 @@ namespace Beam {
     return value;
   }
 
+  template<typename T>
+  void StateQueue<T>::PopAll(Out<std::vector<Source>> values) {
+    values->push_back(Pop());
+  }
+
+  template<typename T>
+  bool StateQueue<T>::TryPopAll(Out<std::vector<Source>> values) {
+    auto lock = boost::lock_guard(m_mutex);
+    if(!m_value) {
+      return false;
+    }
+    values->push_back(std::move(*m_value));
+    m_value = boost::none;
+    return true;
+  }
+
+  template<typename T>
+  bool StateQueue<T>::SetReadinessCallback(
+      std::function<void (const std::exception_ptr&)> callback) {
+    auto lock = boost::lock_guard(m_mutex);
+    m_readinessCallback = std::move(callback);
+    if(m_readinessCallback && m_value) {
+      m_readinessCallback(nullptr);
+    }
+    if(m_readinessCallback && m_breakException) {
+      m_readinessCallback(m_breakException);
+    }
+    return true;
+  }
+
   template<typename T>
   void StateQueue<T>::Push(const Target& value) {
     auto lock = boost::lock_guard(m_mutex);
@@ -94,6 +134,9 @@ namespace Beam {
     } else {
       m_value.emplace(value);
       m_isAvailableCondition.notify_all();
+      if(m_readinessCallback) {
+        m_readinessCallback(nullptr);
+      }
     }
   }
 
@@ -108,6 +151,9 @@ namespace Beam {
     } else {
       m_value.emplace(std::move(value));
       m_isAvailableCondition.notify_all();
+      if(m_readinessCallback) {
+        m_readinessCallback(nullptr);
+      }
     }
   }
 
@@ -119,6 +165,9 @@ namespace Beam {
     }
     m_breakException = exception;
     m_isAvailableCondition.notify_all();
+    if(m_readinessCallback) {
+      m_readinessCallback(m_breakException);
+    }
   }
 
   template<typename T>
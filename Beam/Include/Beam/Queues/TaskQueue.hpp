@@ -2,14 +2,29 @@
 #define BEAM_TASK_QUEUE_HPP
 #include <atomic>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include "Beam/Queues/AbstractQueue.hpp"
 #include "Beam/Queues/CallbackQueue.hpp"
-#include "Beam/Queues/Queue.hpp"
+#include "Beam/Queues/PipeBrokenException.hpp"
 #include "Beam/Queues/Queues.hpp"
+#include "Beam/Threading/ConditionVariable.hpp"
+#include "Beam/Threading/Task.hpp"
 #include "Beam/Utilities/ReportException.hpp"
 
 namespace Beam {
 
-  /** Used to translate queue pushes into task functions. */
+  /**
+   * Used to translate queue pushes into task functions. Tasks are stored as
+   * Threading::Tasks in buffers that are recycled between pushes and pops, so
+   * that pushing a small callable and draining it through PopAll does not
+   * allocate. Tasks pushed as a <i>std::function</i> are popped back out as
+   * one without allocating, any other callable is shared behind the
+   * <i>std::function</i> that Pop, TryPop and PopAll return.
+   */
   class TaskQueue : public AbstractQueue<std::function<void ()>> {
     public:
       using Target = AbstractQueue<std::function<void ()>>::Target;
@@ -57,6 +72,32 @@ namespace Beam {
 
       boost::optional<Source> TryPop() override;
 
+      void PopAll(Out<std::vector<Source>> values) override;
+
+      bool TryPopAll(Out<std::vector<Source>> values) override;
+
+      /**
+       * Pops every task available, blocking until at least one task is
+       * available.
+       * @param tasks Stores the popped tasks in the order they were pushed.
+       */
+      void PopAll(Out<std::vector<Threading::Task>> tasks);
+
+      /**
+       * Pops every task available without blocking.
+       * @param tasks Stores the popped tasks in the order they were pushed.
+       * @return <code>true</code> iff at least one task was popped.
+       */
+      bool TryPopAll(Out<std::vector<Threading::Task>> tasks);
+
+      /**
+       * Pushes a callable without wrapping it in a <i>std::function</i>.
+       * @param task The callable to push.
+       */
+      template<typename F, typename = std::enable_if_t<
+        !std::is_same_v<std::decay_t<F>, Target>>>
+      void Push(F&& task);
+
       void Push(const Target& value) override;
 
       void Push(Target&& value) override;
@@ -67,9 +108,21 @@ namespace Beam {
 
     private:
       std::atomic_bool m_isBroken;
-      Queue<Source> m_tasks;
+      boost::mutex m_mutex;
+      Threading::ConditionVariable m_isAvailableCondition;
+      std::vector<Threading::Task> m_tasks;
+      std::size_t m_head;
+      int m_waitingCount;
+      std::exception_ptr m_breakException;
       CallbackQueue m_callbacks;
 
+      static Source Wrap(Threading::Task task);
+      Threading::Task UnlockedPop();
+      void UnlockedPopAll(std::vector<Threading::Task>& tasks);
+      void PushTask(Threading::Task task);
+      void UnlockedWait(boost::unique_lock<boost::mutex>& lock);
+      void BreakTasks(const std::exception_ptr& exception);
+
       template<typename T, typename F, typename B>
       auto GetSlotHelper(F&& callback, B&& breakCallback);
   };
@@ -80,9 +133,17 @@ namespace Beam {
    */
   template<typename TaskQueueType>
   void TaskLoop(TaskQueueType taskQueue) {
+    using Task = std::conditional_t<std::is_base_of_v<TaskQueue,
+      GetTryDereferenceType<TaskQueueType>>, Threading::Task,
+      typename GetTryDereferenceType<TaskQueueType>::Source>;
+    auto tasks = std::vector<Task>();
     try {
       while(true) {
-        taskQueue->Pop()();
+        taskQueue->PopAll(Store(tasks));
+        for(auto& task : tasks) {
+          task();
+        }
+        tasks.clear();
       }
     } catch(const PipeBrokenException&) {
       return;
@@ -103,18 +164,38 @@ namespace Beam {
     });
   }
 
+  /**
+   * Spawns a Routine that executes tasks on a specific Scheduler context.
+   * @param taskQueue The Queue to read the tasks from.
+   * @param contextId The id of the context to run the Routine in.
+   * @return The spawned Routine's Id.
+   */
+  template<typename TaskQueueType>
+  Routines::Routine::Id SpawnTaskRoutine(TaskQueueType taskQueue,
+      std::size_t contextId) {
+    return Routines::Spawn([taskQueue = std::move(taskQueue)] {
+      TaskLoop(taskQueue);
+    }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE, contextId);
+  }
+
   /**
    * Pops off all tasks pushed onto a TaskQueue and invokes them.
    * @param tasks The TaskQueue to handle.
    */
   inline void HandleTasks(TaskQueue& tasks) {
-    while(auto task = tasks.TryPop()) {
-      (*task)();
+    auto pendingTasks = std::vector<Threading::Task>();
+    while(tasks.TryPopAll(Store(pendingTasks))) {
+      for(auto& task : pendingTasks) {
+        task();
+      }
+      pendingTasks.clear();
     }
   }
 
   inline TaskQueue::TaskQueue()
-    : m_isBroken(false) {}
+    : m_isBroken(false),
+      m_head(0),
+      m_waitingCount(0) {}
 
   template<typename T, typename F>
   auto TaskQueue::GetSlot(F&& callback) {
@@ -142,42 +223,154 @@ namespace Beam {
   }
 
   inline TaskQueue::Source TaskQueue::Pop() {
-    return m_tasks.Pop();
+    auto lock = boost::unique_lock(m_mutex);
+    while(m_head == m_tasks.size() && !m_breakException) {
+      UnlockedWait(lock);
+    }
+    if(m_head == m_tasks.size()) {
+      std::rethrow_exception(m_breakException);
+    }
+    return Wrap(UnlockedPop());
   }
 
   inline boost::optional<TaskQueue::Source> TaskQueue::TryPop() {
-    return m_tasks.TryPop();
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_head == m_tasks.size()) {
+      return boost::none;
+    }
+    return Wrap(UnlockedPop());
+  }
+
+  inline void TaskQueue::PopAll(Out<std::vector<Source>> values) {
+    auto tasks = std::vector<Threading::Task>();
+    PopAll(Store(tasks));
+    for(auto& task : tasks) {
+      values->push_back(Wrap(std::move(task)));
+    }
+  }
+
+  inline bool TaskQueue::TryPopAll(Out<std::vector<Source>> values) {
+    auto tasks = std::vector<Threading::Task>();
+    if(!TryPopAll(Store(tasks))) {
+      return false;
+    }
+    for(auto& task : tasks) {
+      values->push_back(Wrap(std::move(task)));
+    }
+    return true;
+  }
+
+  inline void TaskQueue::PopAll(Out<std::vector<Threading::Task>> tasks) {
+    auto lock = boost::unique_lock(m_mutex);
+    while(m_head == m_tasks.size() && !m_breakException) {
+      UnlockedWait(lock);
+    }
+    if(m_head == m_tasks.size()) {
+      std::rethrow_exception(m_breakException);
+    }
+    UnlockedPopAll(*tasks);
+  }
+
+  inline bool TaskQueue::TryPopAll(Out<std::vector<Threading::Task>> tasks) {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_head == m_tasks.size()) {
+      return false;
+    }
+    UnlockedPopAll(*tasks);
+    return true;
+  }
+
+  template<typename F, typename>
+  void TaskQueue::Push(F&& task) {
+    PushTask(Threading::Task(std::forward<F>(task)));
   }
 
   inline void TaskQueue::Push(const Target& value) {
-    m_tasks.Push(value);
+    PushTask(Threading::Task(value));
   }
 
   inline void TaskQueue::Push(Target&& value) {
-    m_tasks.Push(std::move(value));
+    PushTask(Threading::Task(std::move(value)));
   }
 
   inline void TaskQueue::Break(const std::exception_ptr& exception) {
     if(!m_isBroken.exchange(true)) {
       m_callbacks.Break(exception);
       Push([=] {
-        m_tasks.Break(exception);
+        BreakTasks(exception);
       });
     }
   }
 
+  inline TaskQueue::Source TaskQueue::Wrap(Threading::Task task) {
+    if(auto function = task.Target<Source>()) {
+      return std::move(*function);
+    }
+    return [task = std::make_shared<Threading::Task>(std::move(task))] {
+      (*task)();
+    };
+  }
+
+  inline Threading::Task TaskQueue::UnlockedPop() {
+    auto task = std::move(m_tasks[m_head]);
+    ++m_head;
+    if(m_head == m_tasks.size()) {
+      m_tasks.clear();
+      m_head = 0;
+    }
+    return task;
+  }
+
+  inline void TaskQueue::UnlockedPopAll(std::vector<Threading::Task>& tasks) {
+    if(m_head == 0 && tasks.empty()) {
+      tasks.swap(m_tasks);
+    } else {
+      tasks.insert(tasks.end(),
+        std::make_move_iterator(m_tasks.begin() + m_head),
+        std::make_move_iterator(m_tasks.end()));
+      m_tasks.clear();
+    }
+    m_head = 0;
+  }
+
+  inline void TaskQueue::PushTask(Threading::Task task) {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_breakException) {
+      std::rethrow_exception(m_breakException);
+    }
+    m_tasks.push_back(std::move(task));
+    if(m_waitingCount != 0) {
+      m_isAvailableCondition.notify_one();
+    }
+  }
+
+  inline void TaskQueue::UnlockedWait(boost::unique_lock<boost::mutex>& lock) {
+    ++m_waitingCount;
+    m_isAvailableCondition.wait(lock);
+    --m_waitingCount;
+  }
+
+  inline void TaskQueue::BreakTasks(const std::exception_ptr& exception) {
+    auto lock = boost::lock_guard(m_mutex);
+    if(m_breakException) {
+      return;
+    }
+    m_breakException = exception;
+    m_isAvailableCondition.notify_all();
+  }
+
   template<typename T, typename F, typename B>
   auto TaskQueue::GetSlotHelper(F&& callback, B&& breakCallback) {
     return m_callbacks.GetSlot<T>(
       [=, callback = std::make_shared<std::remove_reference_t<F>>(
           std::forward<F>(callback))] (const T& value) {
-        m_tasks.Push([=] {
+        Push([=] {
           (*callback)(value);
         });
       },
       [=, breakCallback = std::make_shared<std::remove_reference_t<B>>(
           std::forward<B>(breakCallback))] (const std::exception_ptr& e) {
-        m_tasks.Push([=] () {
+        Push([=] {
           (*breakCallback)(e);
         });
       });
@@ -1,7 +1,12 @@
 #ifndef BEAM_ASYNC_HPP
 #define BEAM_ASYNC_HPP
+#include <atomic>
+#include <cstdint>
+#include <limits>
 #include <type_traits>
+#include <vector>
 #include <boost/call_traits.hpp>
+#include <boost/intrusive/list.hpp>
 #include <boost/optional/optional.hpp>
 #include <boost/thread/mutex.hpp>
 #include "Beam/Pointers/Ref.hpp"
@@ -10,6 +15,97 @@
 #include "Beam/Utilities/StorageType.hpp"
 
 namespace Beam::Routines {
+namespace Details {
+  struct AsyncObserver;
+  template<typename T> struct AsyncAwaiter;
+
+  template<typename F>
+  std::size_t Await(std::size_t count, std::size_t threshold, F&& get);
+
+  /** Registers an AsyncObserver with a single Async. */
+  struct AsyncObserverNode : public boost::intrusive::list_base_hook<> {
+
+    /** The function called when the Async completes. */
+    void (*m_callback)(AsyncObserverNode& node);
+
+    /** The observer to notify. */
+    AsyncObserver* m_observer;
+
+    /** The index of the Async being observed. */
+    std::size_t m_index;
+
+    /** Whether this node occupies the Async's waiter slot. */
+    bool m_isSlotted;
+
+    /** Whether this node is in the Async's queue of observers. */
+    bool m_isQueued;
+  };
+
+  /** Resumes a Routine once a number of the Asyncs it observes complete. */
+  struct AsyncObserver {
+
+    /** Indicates that no observed Async has completed. */
+    static constexpr auto NONE = std::numeric_limits<std::size_t>::max();
+
+    /** The bit of m_remaining set once the Routine is about to suspend. */
+    static constexpr auto SUSPENDED = std::size_t(1);
+
+    /** The amount a single completion subtracts from m_remaining. */
+    static constexpr auto COMPLETION = std::size_t(2);
+
+    /** The Routine to resume. */
+    Routine* m_routine;
+
+    /**
+     * The number of completions remaining before resuming the Routine in
+     * units of COMPLETION, combined with the SUSPENDED bit.
+     */
+    std::atomic_size_t m_remaining;
+
+    /** The number of references to this observer. */
+    std::atomic_size_t m_references;
+
+    /** The index of the first Async to complete. */
+    std::atomic_size_t m_index;
+
+    /** The nodes registered with each observed Async. */
+    std::vector<AsyncObserverNode> m_nodes;
+
+    /**
+     * Constructs an AsyncObserver for the current Routine.
+     * @param count The number of Asyncs to observe.
+     * @param threshold The number of completions to wait for.
+     */
+    AsyncObserver(std::size_t count, std::size_t threshold);
+
+    /** Returns <code>true</code> iff more completions are required. */
+    bool IsPending() const;
+
+    /**
+     * Records a completion, excess completions are ignored.
+     * @return <code>true</code> iff this was the last completion required
+     *         and the Routine is suspended, in which case the caller must
+     *         resume it.
+     */
+    bool Decrement();
+
+    /**
+     * Marks the Routine as about to suspend.
+     * @return <code>true</code> iff the Routine must suspend, otherwise every
+     *         required completion has already been recorded.
+     */
+    bool Park();
+
+    /**
+     * Records the completion of an observed Async.
+     * @param index The index of the Async that completed.
+     */
+    void Notify(std::size_t index);
+
+    /** Releases a reference to this observer. */
+    void Release();
+  };
+}
 
   /** Stores details common to all the Async templates. */
   class BaseAsync {
@@ -30,16 +126,58 @@ namespace Beam::Routines {
 
     protected:
 
+      /** The state of the operation. */
+      std::atomic<State> m_state;
+
       /** Constructs an empty BaseAsync. */
-      BaseAsync() = default;
+      BaseAsync();
+
+      /** Returns <code>true</code> iff the operation has completed. */
+      bool IsComplete() const;
+
+      /** Suspends the current Routine until the operation completes. */
+      void Wait();
+
+      /**
+       * Completes the operation and resumes all waiters.
+       * @param state The state of the completed operation.
+       */
+      void Complete(State state);
+
+      /** Resets the waiters so that the operation can be reused. */
+      void ResetWaiters();
 
     private:
+      template<typename F>
+      friend std::size_t Details::Await(std::size_t, std::size_t, F&&);
+      template<typename T>
+      friend struct Details::AsyncAwaiter;
+      using AsyncObserverQueue =
+        boost::intrusive::list<Details::AsyncObserverNode>;
+      static constexpr auto NO_WAITER = std::uintptr_t(0);
+      static constexpr auto COMPLETED_WAITER = std::uintptr_t(1);
+      static constexpr auto OBSERVER_TAG = std::uintptr_t(2);
+      static constexpr auto QUEUED_TAG = std::uintptr_t(4);
+      std::atomic_uintptr_t m_waiter;
+      boost::mutex m_mutex;
+      SuspendedRoutineQueue m_suspendedRoutines;
+      AsyncObserverQueue m_observers;
+
       BaseAsync(const BaseAsync&) = delete;
       BaseAsync& operator =(const BaseAsync&) = delete;
+      static void ResumeWaiter(std::uintptr_t waiter);
+      bool MarkQueued();
+      bool Observe(Details::AsyncObserverNode& node);
+      bool Unobserve(Details::AsyncObserverNode& node);
   };
 
   /**
-   * Stores the result of an asynchronous operation.
+   * Stores the result of an asynchronous operation. The first Routine to wait
+   * on the result occupies a single waiter slot and only additional waiters
+   * fall back to a locked queue, completion is lock-free unless that queue is
+   * in use. When no waiters are queued, completion touches no member after
+   * publishing the result, so a waiter may destroy the Async as soon as it
+   * observes the completion.
    * @param <T> The type of the asynchronous result.
    */
   template<typename T>
@@ -70,13 +208,8 @@ namespace Beam::Routines {
 
     private:
       friend class Eval<Type>;
-      mutable boost::mutex m_mutex;
-      State m_state;
-      SuspendedRoutineQueue m_suspendedRoutines;
       boost::optional<typename StorageType<Type>::type> m_result;
       std::exception_ptr m_exception;
-
-      void SetState(State state);
   };
 
   /** Base class for the Eval template. */
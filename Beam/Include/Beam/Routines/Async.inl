@@ -6,9 +6,227 @@
 #include "Beam/Routines/SuspendedRoutineQueue.hpp"
 
 namespace Beam::Routines {
+namespace Details {
+  inline AsyncObserver::AsyncObserver(std::size_t count,
+    std::size_t threshold)
+    : m_routine(&GetCurrentRoutine()),
+      m_remaining(threshold * COMPLETION),
+      m_references(1),
+      m_index(NONE),
+      m_nodes(count) {}
+
+  inline bool AsyncObserver::IsPending() const {
+    return m_remaining.load() >= COMPLETION;
+  }
+
+  inline bool AsyncObserver::Decrement() {
+    auto remaining = m_remaining.load();
+    while(remaining >= COMPLETION) {
+      if(m_remaining.compare_exchange_weak(remaining,
+          remaining - COMPLETION)) {
+        return remaining - COMPLETION == SUSPENDED;
+      }
+    }
+    return false;
+  }
+
+  inline bool AsyncObserver::Park() {
+    auto remaining = m_remaining.load();
+    while(remaining >= COMPLETION) {
+      if(m_remaining.compare_exchange_weak(remaining,
+          remaining | SUSPENDED)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  inline void AsyncObserver::Notify(std::size_t index) {
+    auto none = NONE;
+    m_index.compare_exchange_strong(none, index);
+    if(Decrement()) {
+      auto routine = m_routine;
+      Routines::Resume(routine);
+    }
+  }
+
+  inline void AsyncObserver::Release() {
+    if(m_references.fetch_sub(1) == 1) {
+      delete this;
+    }
+  }
+
+  template<typename F>
+  std::size_t Await(std::size_t count, std::size_t threshold, F&& get) {
+    auto observer = new AsyncObserver(count, threshold);
+    for(auto i = std::size_t(0); i != count && observer->IsPending(); ++i) {
+      auto& node = observer->m_nodes[i];
+      node.m_callback = [] (auto& node) {
+        auto observer = node.m_observer;
+        observer->Notify(node.m_index);
+        observer->Release();
+      };
+      node.m_observer = observer;
+      node.m_index = i;
+      ++observer->m_references;
+      if(!static_cast<BaseAsync&>(get(i)).Observe(node)) {
+        node.m_observer = nullptr;
+        --observer->m_references;
+        auto none = AsyncObserver::NONE;
+        observer->m_index.compare_exchange_strong(none, i);
+        observer->Decrement();
+      }
+    }
+    if(observer->Park()) {
+      Routines::Suspend();
+    }
+    for(auto& node : observer->m_nodes) {
+      if(node.m_observer &&
+          static_cast<BaseAsync&>(get(node.m_index)).Unobserve(node)) {
+        observer->Release();
+      }
+    }
+    auto index = observer->m_index.load();
+    observer->Release();
+    return index;
+  }
+}
+
+  inline BaseAsync::BaseAsync()
+    : m_state(State::PENDING),
+      m_waiter(NO_WAITER) {}
+
+  inline bool BaseAsync::IsComplete() const {
+    return m_waiter.load(std::memory_order_acquire) == COMPLETED_WAITER;
+  }
+
+  inline void BaseAsync::Wait() {
+    auto waiter = NO_WAITER;
+    if(m_waiter.compare_exchange_strong(waiter,
+        reinterpret_cast<std::uintptr_t>(&GetCurrentRoutine()))) {
+      do {
+        Routines::Suspend();
+      } while(!IsComplete());
+      return;
+    } else if(waiter == COMPLETED_WAITER) {
+      return;
+    }
+    auto lock = boost::unique_lock(m_mutex);
+    if(!MarkQueued()) {
+      return;
+    }
+    while(m_waiter.load() != COMPLETED_WAITER) {
+      Routines::Suspend(Store(m_suspendedRoutines), lock);
+    }
+  }
+
+  inline void BaseAsync::Complete(State state) {
+    assert(m_state == State::PENDING);
+    assert(state != State::PENDING);
+    m_state.store(state, std::memory_order_release);
+    auto waiter = m_waiter.load();
+    while(!(waiter & QUEUED_TAG)) {
+      if(m_waiter.compare_exchange_weak(waiter, COMPLETED_WAITER)) {
+        ResumeWaiter(waiter);
+        return;
+      }
+    }
+    auto suspendedRoutines = SuspendedRoutineQueue();
+    auto observers = AsyncObserverQueue();
+    {
+      auto lock = boost::lock_guard(m_mutex);
+      suspendedRoutines.swap(m_suspendedRoutines);
+      while(!m_observers.empty()) {
+        auto& node = m_observers.front();
+        m_observers.pop_front();
+        node.m_isQueued = false;
+        observers.push_back(node);
+      }
+      waiter = m_waiter.exchange(COMPLETED_WAITER);
+    }
+    while(!suspendedRoutines.empty()) {
+      auto routine = suspendedRoutines.front().m_routine;
+      suspendedRoutines.pop_front();
+      Routines::Resume(routine);
+    }
+    while(!observers.empty()) {
+      auto& node = observers.front();
+      observers.pop_front();
+      node.m_callback(node);
+    }
+    ResumeWaiter(waiter & ~QUEUED_TAG);
+  }
+
+  inline void BaseAsync::ResetWaiters() {
+    m_waiter.store(NO_WAITER, std::memory_order_relaxed);
+    m_state.store(State::PENDING, std::memory_order_release);
+  }
+
+  inline void BaseAsync::ResumeWaiter(std::uintptr_t waiter) {
+    if(waiter & OBSERVER_TAG) {
+      auto& node = *reinterpret_cast<Details::AsyncObserverNode*>(
+        waiter & ~OBSERVER_TAG);
+      node.m_callback(node);
+    } else if(waiter != NO_WAITER) {
+      auto routine = reinterpret_cast<Routine*>(waiter);
+      Routines::Resume(routine);
+    }
+  }
+
+  inline bool BaseAsync::MarkQueued() {
+    auto waiter = m_waiter.load();
+    while(waiter != COMPLETED_WAITER) {
+      if(waiter & QUEUED_TAG || m_waiter.compare_exchange_weak(waiter,
+          waiter | QUEUED_TAG)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  inline bool BaseAsync::Observe(Details::AsyncObserverNode& node) {
+    auto waiter = NO_WAITER;
+    node.m_isSlotted = true;
+    node.m_isQueued = false;
+    if(m_waiter.compare_exchange_strong(waiter,
+        reinterpret_cast<std::uintptr_t>(&node) | OBSERVER_TAG)) {
+      return true;
+    }
+    node.m_isSlotted = false;
+    if(waiter == COMPLETED_WAITER) {
+      return false;
+    }
+    auto lock = boost::lock_guard(m_mutex);
+    if(!MarkQueued()) {
+      return false;
+    }
+    node.m_isQueued = true;
+    m_observers.push_back(node);
+    return true;
+  }
+
+  inline bool BaseAsync::Unobserve(Details::AsyncObserverNode& node) {
+    if(node.m_isSlotted) {
+      auto slot = reinterpret_cast<std::uintptr_t>(&node) | OBSERVER_TAG;
+      auto waiter = m_waiter.load();
+      while((waiter & ~QUEUED_TAG) == slot) {
+        if(m_waiter.compare_exchange_weak(waiter, waiter & QUEUED_TAG)) {
+          return true;
+        }
+      }
+      return false;
+    }
+    auto lock = boost::lock_guard(m_mutex);
+    if(!node.m_isQueued) {
+      return false;
+    }
+    m_observers.erase(m_observers.iterator_to(node));
+    node.m_isQueued = false;
+    return true;
+  }
+
   template<typename T>
-  Async<T>::Async()
-    : m_state(State::PENDING) {}
+  Async<T>::Async() = default;
 
   template<typename T>
   Eval<typename Async<T>::Type> Async<T>::GetEval() {
@@ -24,11 +242,10 @@ namespace Beam::Routines {
   template<typename T>
   typename boost::call_traits<typename StorageType<T>::type>::reference
       Async<T>::Get() {
-    auto lock = boost::unique_lock(m_mutex);
-    while(m_state == State::PENDING) {
-      Routines::Suspend(Store(m_suspendedRoutines), lock);
+    if(!IsComplete()) {
+      Wait();
     }
-    if(m_state == State::EXCEPTION) {
+    if(m_state.load(std::memory_order_relaxed) == State::EXCEPTION) {
       std::rethrow_exception(m_exception);
     }
     return VoidReturn(*m_result);
@@ -36,26 +253,17 @@ namespace Beam::Routines {
 
   template<typename T>
   BaseAsync::State Async<T>::GetState() const {
-    return m_state;
+    return m_state.load(std::memory_order_acquire);
   }
 
   template<typename T>
   void Async<T>::Reset() {
-    if(m_state == State::PENDING) {
+    if(m_state.load(std::memory_order_relaxed) == State::PENDING) {
       return;
     }
     m_exception = nullptr;
-    m_state = State::PENDING;
     m_result = boost::none;
-  }
-
-  template<typename T>
-  void Async<T>::SetState(State state) {
-    auto lock = boost::lock_guard(m_mutex);
-    assert(m_state == State::PENDING);
-    assert(state != State::PENDING);
-    m_state = state;
-    Routines::Resume(Store(m_suspendedRoutines));
+    ResetWaiters();
   }
 
   template<typename E>
@@ -94,9 +302,9 @@ namespace Beam::Routines {
       return;
     }
     auto async = std::exchange(m_async, nullptr);
-    assert(async->m_state == BaseAsync::State::PENDING);
+    assert(async->GetState() == BaseAsync::State::PENDING);
     async->m_result.emplace(std::forward<R>(result));
-    async->SetState(BaseAsync::State::COMPLETE);
+    async->Complete(BaseAsync::State::COMPLETE);
   }
 
   template<typename T>
@@ -105,9 +313,9 @@ namespace Beam::Routines {
       return;
     }
     auto async = std::exchange(m_async, nullptr);
-    assert(async->m_state == BaseAsync::State::PENDING);
+    assert(async->GetState() == BaseAsync::State::PENDING);
     async->m_result.emplace();
-    async->SetState(BaseAsync::State::COMPLETE);
+    async->Complete(BaseAsync::State::COMPLETE);
   }
 
   template<typename T>
@@ -117,9 +325,9 @@ namespace Beam::Routines {
       return;
     }
     auto async = std::exchange(m_async, nullptr);
-    assert(async->m_state == BaseAsync::State::PENDING);
+    assert(async->GetState() == BaseAsync::State::PENDING);
     async->m_result.emplace(std::forward<R>(result)...);
-    async->SetState(BaseAsync::State::COMPLETE);
+    async->Complete(BaseAsync::State::COMPLETE);
   }
 
   template<typename T>
@@ -128,9 +336,9 @@ namespace Beam::Routines {
       return;
     }
     auto async = std::exchange(m_async, nullptr);
-    assert(async->m_state == BaseAsync::State::PENDING);
+    assert(async->GetState() == BaseAsync::State::PENDING);
     async->m_exception = e;
-    async->SetState(BaseAsync::State::EXCEPTION);
+    async->Complete(BaseAsync::State::EXCEPTION);
   }
 
   template<typename T>
@@ -0,0 +1,299 @@
+#ifndef BEAM_COROUTINE_HPP
+#define BEAM_COROUTINE_HPP
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <boost/optional/optional.hpp>
+#include "Beam/Routines/Async.hpp"
+#include "Beam/Routines/Routine.hpp"
+#include "Beam/Routines/Routines.hpp"
+#include "Beam/Routines/Scheduler.hpp"
+
+namespace Beam::Routines {
+  template<typename T = void> class Coroutine;
+
+namespace Details {
+  template<typename T>
+  struct CoroutineResult {
+    boost::optional<T> m_value;
+    std::exception_ptr m_exception;
+
+    template<typename V>
+    void return_value(V&& value) {
+      m_value.emplace(std::forward<V>(value));
+    }
+
+    T Extract() {
+      if(m_exception) {
+        std::rethrow_exception(m_exception);
+      }
+      return std::move(*m_value);
+    }
+
+    void Forward(Eval<T>& eval) {
+      if(m_exception) {
+        eval.SetException(m_exception);
+      } else {
+        eval.SetResult(std::move(*m_value));
+      }
+    }
+  };
+
+  template<>
+  struct CoroutineResult<void> {
+    std::exception_ptr m_exception;
+
+    void return_void() {}
+
+    void Extract() {
+      if(m_exception) {
+        std::rethrow_exception(m_exception);
+      }
+    }
+
+    void Forward(Eval<void>& eval) {
+      if(m_exception) {
+        eval.SetException(m_exception);
+      } else {
+        eval.SetResult();
+      }
+    }
+  };
+
+  template<typename T>
+  struct CoroutinePromise : CoroutineResult<T> {
+    struct FinalAwaiter {
+      bool await_ready() const noexcept {
+        return false;
+      }
+
+      std::coroutine_handle<> await_suspend(
+          std::coroutine_handle<CoroutinePromise> handle) noexcept {
+        auto& promise = handle.promise();
+        if(promise.m_continuation) {
+          return promise.m_continuation;
+        }
+        promise.Forward(promise.m_eval);
+        handle.destroy();
+        return std::noop_coroutine();
+      }
+
+      void await_resume() const noexcept {}
+    };
+
+    std::size_t m_contextId;
+    std::coroutine_handle<> m_continuation;
+    Eval<T> m_eval;
+
+    CoroutinePromise()
+      : m_contextId(-1) {}
+
+    Coroutine<T> get_return_object() {
+      return Coroutine<T>(
+        std::coroutine_handle<CoroutinePromise>::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() const noexcept {
+      return {};
+    }
+
+    FinalAwaiter final_suspend() const noexcept {
+      return {};
+    }
+
+    void unhandled_exception() {
+      this->m_exception = std::current_exception();
+    }
+  };
+
+  inline void ResumeCoroutine(void* address) {
+    std::coroutine_handle<>::from_address(address).resume();
+  }
+
+  template<typename T>
+  struct AsyncAwaiter : AsyncObserverNode {
+    Async<T>* m_async;
+    std::coroutine_handle<> m_handle;
+    std::size_t m_contextId;
+
+    explicit AsyncAwaiter(Async<T>& async)
+      : m_async(&async) {}
+
+    bool await_ready() const {
+      return m_async->IsComplete();
+    }
+
+    template<typename P>
+    bool await_suspend(std::coroutine_handle<P> handle) {
+      m_handle = handle;
+      m_contextId = handle.promise().m_contextId;
+      m_callback = [] (auto& node) {
+        auto& awaiter = static_cast<AsyncAwaiter&>(node);
+        auto handle = awaiter.m_handle;
+        Scheduler::GetInstance().Post(awaiter.m_contextId, &ResumeCoroutine,
+          handle.address());
+      };
+      return static_cast<BaseAsync&>(*m_async).Observe(*this);
+    }
+
+    decltype(auto) await_resume() {
+      return m_async->Get();
+    }
+  };
+
+  template<typename T>
+  struct CoroutineAwaiter {
+    std::coroutine_handle<CoroutinePromise<T>> m_handle;
+
+    bool await_ready() const noexcept {
+      return false;
+    }
+
+    template<typename P>
+    std::coroutine_handle<> await_suspend(
+        std::coroutine_handle<P> continuation) noexcept {
+      auto& promise = m_handle.promise();
+      promise.m_continuation = continuation;
+      promise.m_contextId = continuation.promise().m_contextId;
+      return m_handle;
+    }
+
+    T await_resume() {
+      return m_handle.promise().Extract();
+    }
+  };
+}
+
+  /**
+   * A lazily started stackless coroutine that runs on the Scheduler's
+   * contexts without a stack of its own. A Coroutine may co_await an Async
+   * or another Coroutine, but must not call blocking Routine functions such
+   * as Async::Get on a pending Async since it runs outside of any Routine.
+   * @param <T> The type of value the Coroutine returns.
+   */
+  template<typename T>
+  class Coroutine {
+    public:
+
+      /** The type of value the Coroutine returns. */
+      using Type = T;
+
+      /** The coroutine's promise type. */
+      using promise_type = Details::CoroutinePromise<Type>;
+
+      /**
+       * Acquires a Coroutine.
+       * @param coroutine The Coroutine to acquire.
+       */
+      Coroutine(Coroutine&& coroutine) noexcept;
+
+      ~Coroutine();
+
+      /**
+       * Acquires a Coroutine.
+       * @param rhs The Coroutine to acquire.
+       */
+      Coroutine& operator =(Coroutine&& rhs) noexcept;
+
+      /**
+       * Runs this Coroutine on the awaiting Coroutine's context and resumes
+       * the awaiting Coroutine with its result.
+       */
+      auto operator co_await() && noexcept;
+
+    private:
+      friend promise_type;
+      template<typename U>
+      friend void Spawn(Coroutine<U> coroutine, Eval<U> result,
+        std::size_t contextId);
+      std::coroutine_handle<promise_type> m_handle;
+
+      explicit Coroutine(std::coroutine_handle<promise_type> handle);
+      Coroutine(const Coroutine&) = delete;
+      Coroutine& operator =(const Coroutine&) = delete;
+  };
+
+  /**
+   * Spawns a Coroutine on a Scheduler context.
+   * @param coroutine The Coroutine to spawn.
+   * @param result Stores the result of the <i>coroutine</i>.
+   * @param contextId The specific context id to run the Coroutine in, or -1
+   *        to resume it on an arbitrary context each time it is suspended.
+   */
+  template<typename T>
+  void Spawn(Coroutine<T> coroutine, Eval<T> result, std::size_t contextId) {
+    auto handle = std::exchange(coroutine.m_handle, nullptr);
+    auto& promise = handle.promise();
+    promise.m_eval = std::move(result);
+    promise.m_contextId = contextId;
+    Details::Scheduler::GetInstance().Post(contextId,
+      &Details::ResumeCoroutine, handle.address());
+  }
+
+  /**
+   * Spawns a Coroutine on an arbitrary Scheduler context.
+   * @param coroutine The Coroutine to spawn.
+   * @param result Stores the result of the <i>coroutine</i>.
+   */
+  template<typename T>
+  void Spawn(Coroutine<T> coroutine, Eval<T> result) {
+    Spawn(std::move(coroutine), std::move(result), -1);
+  }
+
+  /**
+   * Spawns a Coroutine on an arbitrary Scheduler context, discarding its
+   * result.
+   * @param coroutine The Coroutine to spawn.
+   */
+  template<typename T>
+  void Spawn(Coroutine<T> coroutine) {
+    Spawn(std::move(coroutine), Eval<T>(), -1);
+  }
+
+  /**
+   * Suspends the current Coroutine until an Async completes.
+   * @param async The Async to wait for.
+   * @return The result of the <i>async</i>.
+   */
+  template<typename T>
+  auto operator co_await(Async<T>& async) {
+    return Details::AsyncAwaiter<T>(async);
+  }
+
+  template<typename T>
+  Coroutine<T>::Coroutine(Coroutine&& coroutine) noexcept
+    : m_handle(std::exchange(coroutine.m_handle, nullptr)) {}
+
+  template<typename T>
+  Coroutine<T>::~Coroutine() {
+    if(m_handle) {
+      m_handle.destroy();
+    }
+  }
+
+  template<typename T>
+  Coroutine<T>& Coroutine<T>::operator =(Coroutine&& rhs) noexcept {
+    if(this == &rhs) {
+      return *this;
+    }
+    if(m_handle) {
+      m_handle.destroy();
+    }
+    m_handle = std::exchange(rhs.m_handle, nullptr);
+    return *this;
+  }
+
+  template<typename T>
+  auto Coroutine<T>::operator co_await() && noexcept {
+    return Details::CoroutineAwaiter<T>{m_handle};
+  }
+
+  template<typename T>
+  Coroutine<T>::Coroutine(std::coroutine_handle<promise_type> handle)
+    : m_handle(handle) {}
+}
+
+#endif
+#endif
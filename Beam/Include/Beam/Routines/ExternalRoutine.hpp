@@ -66,11 +66,10 @@ namespace Routines {
 
   inline void ExternalRoutine::Resume() {
     boost::lock_guard<boost::mutex> lock{m_mutex};
-    if(GetState() == State::PENDING_SUSPEND) {
+    if(GetState() != State::SUSPENDED) {
       m_isPendingResume = true;
       return;
     }
-    assert(GetState() == State::SUSPENDED);
     SetState(State::RUNNING);
     m_suspendedCondition.notify_one();
   }
@@ -1,5 +1,6 @@
 #ifndef BEAM_SCHEDULED_ROUTINE_HPP
 #define BEAM_SCHEDULED_ROUTINE_HPP
+#include <chrono>
 #include <iostream>
 #if defined _MSC_VER
 #define BEAM_DISABLE_OPTIMIZATIONS __pragma(optimize( "", off ))
@@ -25,6 +26,12 @@ namespace Beam::Routines {
       /** Returns the id of the context this Routine is running in. */
       std::size_t GetContextId() const;
 
+      /**
+       * Returns <code>true</code> iff this Routine must always run in the
+       * context it was assigned to.
+       */
+      bool IsPinned() const;
+
       /**
        * Continues execution of this Routine from its last defer point or from
        * the beginning if it has not yet executed.
@@ -37,7 +44,8 @@ namespace Beam::Routines {
        * Constructs a ScheduledRoutine.
        * @param stackSize The size of the stack to allocate.
        * @param contextId The id of the Context to run in, or -1 to assign it an
-       *        arbitrary context id.
+       *        arbitrary context id. A Routine given an explicit context id
+       *        is pinned to that context.
        */
       ScheduledRoutine(std::size_t stackSize, std::size_t contextId);
 
@@ -52,8 +60,10 @@ namespace Beam::Routines {
     private:
       friend class Details::Scheduler;
       bool m_isPendingResume;
+      bool m_isPinned;
       std::size_t m_stackSize;
       std::size_t m_contextId;
+      std::chrono::steady_clock::time_point m_queueTimestamp;
       boost::context::continuation m_continuation;
       boost::context::continuation m_parent;
       #ifndef NDEBUG
@@ -70,28 +80,16 @@ namespace Beam::Routines {
     return m_contextId;
   }
 
-  inline void ScheduledRoutine::Continue() {
-    Details::CurrentRoutineGlobal<void>::GetInstance() = this;
-    m_isPendingResume = false;
-    if(GetState() == State::PENDING) {
-      SetState(State::RUNNING);
-      m_continuation = boost::context::callcc(std::allocator_arg,
-        boost::context::fixedsize_stack(m_stackSize),
-        [=] (boost::context::continuation&& parent) {
-          return InitializeRoutine(std::move(parent));
-        });
-    } else {
-      SetState(State::RUNNING);
-      m_continuation = m_continuation.resume();
-    }
-    Details::CurrentRoutineGlobal<void>::GetInstance() = nullptr;
+  inline bool ScheduledRoutine::IsPinned() const {
+    return m_isPinned;
   }
 
   inline ScheduledRoutine::ScheduledRoutine(std::size_t stackSize,
       std::size_t contextId)
       : m_isPendingResume(false),
+        m_isPinned(contextId != static_cast<std::size_t>(-1)),
         m_stackSize(stackSize) {
-    if(contextId == -1) {
+    if(contextId == static_cast<std::size_t>(-1)) {
       m_contextId = GetId() % boost::thread::hardware_concurrency();
     } else {
       m_contextId = contextId;
@@ -1,16 +1,24 @@
 #ifndef BEAM_SCHEDULER_HPP
 #define BEAM_SCHEDULER_HPP
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <deque>
 #include <iostream>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include <boost/thread/condition_variable.hpp>
 #include <boost/thread/mutex.hpp>
 #include <boost/thread/thread.hpp>
 #include "Beam/Routines/FunctionRoutine.hpp"
 #include "Beam/Routines/Routines.hpp"
+#include "Beam/Routines/StackPool.hpp"
 #include "Beam/Threading/Sync.hpp"
+#include "Beam/Threading/ThreadAffinity.hpp"
+#include "Beam/Threading/ThreadPoolConfig.hpp"
 #include "Beam/Utilities/ReportException.hpp"
 #include "Beam/Utilities/Singleton.hpp"
 
@@ -33,23 +41,96 @@ namespace Details {
       static constexpr std::size_t DEFAULT_STACK_SIZE =
         BEAM_SCHEDULER_DEFAULT_STACK_SIZE;
 
+      /** The number of buckets in the scheduling latency histogram. */
+      static constexpr auto LATENCY_BUCKET_COUNT = std::size_t(32);
+
+      /** Stores a snapshot of a single context's counters. */
+      struct ContextStatistics {
+
+        /** The time the snapshot was taken. */
+        std::chrono::steady_clock::time_point m_timestamp;
+
+        /** The number of Routines waiting to run. */
+        std::size_t m_pendingRoutines;
+
+        /** The number of suspended Routines. */
+        std::size_t m_suspendedRoutines;
+
+        /**
+         * The total number of times a Routine was continued, the rate is
+         * obtained by differencing two snapshots over their timestamps.
+         */
+        std::uint64_t m_contextSwitches;
+
+        /** The total number of Routines stolen from other contexts. */
+        std::uint64_t m_steals;
+
+        /** The longest time a single Routine ran without yielding. */
+        std::chrono::nanoseconds m_longestSlice;
+
+        /**
+         * Histogram of the time Routines spent runnable but not running.
+         * Bucket 0 counts latencies under one microsecond, bucket i counts
+         * latencies in [2^(i - 1), 2^i) microseconds and the last bucket
+         * counts everything beyond.
+         */
+        std::array<std::uint64_t, LATENCY_BUCKET_COUNT> m_latencies;
+      };
+
       /**
-       * Constructs a Scheduler with a number of threads equal to the system's
-       * concurrency.
+       * Constructs a Scheduler using the configuration last passed to
+       * SetConfig, by default one thread per system core.
        */
       Scheduler();
 
       ~Scheduler();
 
+      /**
+       * Sets the configuration used to construct the Scheduler, must be
+       * called before the Scheduler is first used.
+       * @param config The thread count, CPU affinity and idle strategy to use.
+       */
+      static void SetConfig(const Threading::ThreadPoolConfig& config);
+
       /** Returns the number of threads used by the Scheduler. */
       std::size_t GetThreadCount() const;
 
+      /**
+       * Returns <code>true</code> iff idle threads steal Routines from other
+       * contexts.
+       */
+      bool IsWorkStealing() const;
+
+      /**
+       * Sets whether idle threads steal Routines from other contexts. Only
+       * Routines that were not spawned with an explicit context id can be
+       * stolen.
+       * @param isWorkStealing <code>true</code> iff idle threads should steal
+       *        pending Routines from other contexts.
+       */
+      void SetWorkStealing(bool isWorkStealing);
+
+      /** Returns the pool used to allocate Routine stacks. */
+      StackPool& GetStackPool();
+
       /**
        * Returns <code>true</code> iff the context with the specified <i>id</i>
        * has Routines pending.
        */
       bool HasPendingRoutines(std::size_t contextId) const;
 
+      /**
+       * Returns a snapshot of a context's counters.
+       * @param contextId The id of the context.
+       */
+      ContextStatistics GetStatistics(std::size_t contextId) const;
+
+      /**
+       * Resets the longest slice recorded by a context.
+       * @param contextId The id of the context.
+       */
+      void ResetLongestSlice(std::size_t contextId);
+
       /**
        * Waits for a Routine to complete.
        * @param id The id of the Routine to wait for.
@@ -60,13 +141,25 @@ namespace Details {
        * Spawns a Routine from a callable object.
        * @param f The callable object to run within the Routine.
        * @param stackSize The size of the stack to allocate for the Routine.
-       * @param contextId The specific context id to run the Routine in, or
-       *        set to the number of threads to assign it an arbitrary context.
+       * @param contextId The specific context id to run the Routine in, taken
+       *        modulo the number of threads, or -1 to assign it an arbitrary
+       *        context.
        * @return A unique ID used to identify the Routine.
        */
       template<typename F>
       Routine::Id Spawn(F&& f, std::size_t stackSize, std::size_t contextId);
 
+      /**
+       * Posts a callback to run directly on a context's thread, outside of
+       * any Routine. Used to resume stackless coroutines.
+       * @param contextId The context to run the callback on, or set to the
+       *        number of threads to assign it an arbitrary context.
+       * @param callback The callback to run.
+       * @param argument The argument passed to the <i>callback</i>.
+       */
+      void Post(std::size_t contextId, void (*callback)(void*),
+        void* argument);
+
       /**
        * Waits for any currently executing Routines to COMPLETE and stops
        * executing any new ones.
@@ -74,40 +167,95 @@ namespace Details {
       void Stop();
 
     private:
+      struct Continuation {
+        void (*m_callback)(void*);
+        void* m_argument;
+      };
       struct Context {
+        std::size_t m_id;
         boost::mutex m_mutex;
         bool m_isRunning;
+        bool m_isStealRequested;
+        std::atomic_bool m_isIdle;
+        std::atomic_size_t m_pendingCount;
         std::deque<ScheduledRoutine*> m_pendingRoutines;
         std::unordered_set<ScheduledRoutine*> m_suspendedRoutines;
+        std::vector<Continuation> m_continuations;
         boost::condition_variable m_pendingRoutinesAvailableCondition;
+        std::atomic_uint64_t m_contextSwitches;
+        std::atomic_uint64_t m_steals;
+        std::atomic_int64_t m_longestSlice;
+        std::array<std::atomic_uint64_t, LATENCY_BUCKET_COUNT> m_latencies;
 
         Context();
       };
       using RoutineIds = std::unordered_map<Routine::Id, ScheduledRoutine*>;
+      struct alignas(64) RoutineIdShard {
+        Threading::Sync<RoutineIds> m_routineIds;
+      };
+      static constexpr auto ROUTINE_ID_SHARD_COUNT = std::size_t(64);
       friend class Beam::Routines::ScheduledRoutine;
       friend void Resume(ScheduledRoutine*& routine);
       std::size_t m_threadCount;
+      boost::posix_time::time_duration m_spinDuration;
       std::unique_ptr<boost::thread[]> m_threads;
-      Threading::Sync<RoutineIds> m_routineIds;
+      std::array<RoutineIdShard, ROUTINE_ID_SHARD_COUNT> m_routineIdShards;
       std::unique_ptr<Context[]> m_contexts;
+      StackPool m_stackPool;
+      std::atomic_bool m_isWorkStealing;
+      std::atomic_size_t m_idleCount;
+      std::atomic_size_t m_nextContextId;
 
+      static Threading::ThreadPoolConfig& GetConfig();
+      Threading::Sync<RoutineIds>& GetRoutineIds(Routine::Id id);
       void Queue(ScheduledRoutine& routine);
       void Suspend(ScheduledRoutine& routine);
       void Resume(ScheduledRoutine& routine);
+      void Push(Context& context, ScheduledRoutine& routine);
+      static void UpdatePendingCount(Context& context);
+      void RequestSteal(const Context& source);
+      ScheduledRoutine* Steal(Context& context);
+      void Record(Context& context, const ScheduledRoutine& routine,
+        std::chrono::steady_clock::time_point start,
+        std::chrono::steady_clock::time_point end);
       void Run(Context& context);
   };
 
   inline Scheduler::Context::Context()
-    : m_isRunning(true) {}
+      : m_id(0),
+        m_isRunning(true),
+        m_isStealRequested(false),
+        m_isIdle(false),
+        m_pendingCount(0),
+        m_contextSwitches(0),
+        m_steals(0),
+        m_longestSlice(0) {
+    for(auto& latency : m_latencies) {
+      latency = 0;
+    }
+  }
 
   inline Scheduler::Scheduler()
-      : m_threadCount(boost::thread::hardware_concurrency()),
+      : m_threadCount(Threading::GetThreadCount(GetConfig())),
+        m_spinDuration(GetConfig().m_spinDuration),
         m_threads(std::make_unique<boost::thread[]>(m_threadCount)),
-        m_contexts(std::make_unique<Context[]>(m_threadCount)) {
+        m_contexts(std::make_unique<Context[]>(m_threadCount)),
+        m_stackPool(StackPool::DEFAULT_RETENTION, false),
+        m_isWorkStealing(false),
+        m_idleCount(0),
+        m_nextContextId(0) {
+    for(auto i = std::size_t(0); i < m_threadCount; ++i) {
+      m_contexts[i].m_id = i;
+    }
     for(auto i = std::size_t(0); i < m_threadCount; ++i) {
       m_threads[i] = boost::thread([=] {
         Run(m_contexts[i]);
       });
+      try {
+        Threading::Pin(m_threads[i], GetConfig(), i);
+      } catch(const std::exception&) {
+        std::cout << BEAM_REPORT_CURRENT_EXCEPTION() << std::flush;
+      }
     }
   }
 
@@ -115,20 +263,60 @@ namespace Details {
     Stop();
   }
 
+  inline void Scheduler::SetConfig(const Threading::ThreadPoolConfig& config) {
+    GetConfig() = config;
+  }
+
   inline std::size_t Scheduler::GetThreadCount() const {
     return m_threadCount;
   }
 
+  inline bool Scheduler::IsWorkStealing() const {
+    return m_isWorkStealing;
+  }
+
+  inline void Scheduler::SetWorkStealing(bool isWorkStealing) {
+    m_isWorkStealing = isWorkStealing;
+  }
+
+  inline StackPool& Scheduler::GetStackPool() {
+    return m_stackPool;
+  }
+
   inline bool Scheduler::HasPendingRoutines(std::size_t contextId) const {
     auto& context = m_contexts[contextId];
     auto lock = boost::lock_guard(context.m_mutex);
     return !context.m_pendingRoutines.empty();
   }
 
+  inline Scheduler::ContextStatistics Scheduler::GetStatistics(
+      std::size_t contextId) const {
+    auto& context = m_contexts[contextId];
+    auto statistics = ContextStatistics();
+    {
+      auto lock = boost::lock_guard(context.m_mutex);
+      statistics.m_pendingRoutines = context.m_pendingRoutines.size();
+      statistics.m_suspendedRoutines = context.m_suspendedRoutines.size();
+    }
+    statistics.m_timestamp = std::chrono::steady_clock::now();
+    statistics.m_contextSwitches = context.m_contextSwitches;
+    statistics.m_steals = context.m_steals;
+    statistics.m_longestSlice = std::chrono::nanoseconds(
+      context.m_longestSlice);
+    for(auto i = std::size_t(0); i < LATENCY_BUCKET_COUNT; ++i) {
+      statistics.m_latencies[i] = context.m_latencies[i];
+    }
+    return statistics;
+  }
+
+  inline void Scheduler::ResetLongestSlice(std::size_t contextId) {
+    m_contexts[contextId].m_longestSlice = 0;
+  }
+
   inline void Scheduler::Wait(Routine::Id id) {
     assert(GetCurrentRoutine().GetId() != id);
     auto waitAsync = Async<void>();
-    auto wait = Threading::With(m_routineIds, [&] (auto& routineIds) {
+    auto wait = Threading::With(GetRoutineIds(id), [&] (auto& routineIds) {
       auto routineIterator = routineIds.find(id);
       if(routineIterator == routineIds.end()) {
         return false;
@@ -148,46 +336,137 @@ namespace Details {
     auto routine = new FunctionRoutine(std::forward<F>(f), stackSize,
       contextId);
     auto id = routine->GetId();
-    Threading::With(m_routineIds, [&] (auto& routineIds) {
+    if(routine->IsPinned()) {
+      routine->m_contextId = contextId % m_threadCount;
+    } else {
+      routine->m_contextId = id % m_threadCount;
+    }
+    Threading::With(GetRoutineIds(id), [&] (auto& routineIds) {
       routineIds.insert(std::pair(id, routine));
     });
     Queue(*routine);
     return id;
   }
 
-  inline void Scheduler::Queue(ScheduledRoutine& routine) {
-    auto& context = m_contexts[routine.GetContextId()];
+  inline void Scheduler::Post(std::size_t contextId,
+      void (*callback)(void*), void* argument) {
+    if(contextId >= m_threadCount) {
+      contextId = m_nextContextId++ % m_threadCount;
+    }
+    auto& context = m_contexts[contextId];
     auto lock = boost::lock_guard(context.m_mutex);
-    context.m_pendingRoutines.push_back(&routine);
-    if(context.m_pendingRoutines.size() == 1) {
+    context.m_continuations.push_back({callback, argument});
+    UpdatePendingCount(context);
+    if(context.m_continuations.size() == 1 &&
+        context.m_pendingRoutines.empty()) {
       context.m_pendingRoutinesAvailableCondition.notify_all();
     }
   }
 
+  inline Threading::ThreadPoolConfig& Scheduler::GetConfig() {
+    static auto config = Threading::ThreadPoolConfig();
+    return config;
+  }
+
+  inline Threading::Sync<Scheduler::RoutineIds>& Scheduler::GetRoutineIds(
+      Routine::Id id) {
+    return m_routineIdShards[id % ROUTINE_ID_SHARD_COUNT].m_routineIds;
+  }
+
+  inline void Scheduler::Queue(ScheduledRoutine& routine) {
+    auto& context = m_contexts[routine.GetContextId()];
+    auto isPinned = routine.IsPinned();
+    {
+      auto lock = boost::lock_guard(context.m_mutex);
+      Push(context, routine);
+    }
+    if(!isPinned) {
+      RequestSteal(context);
+    }
+  }
+
   inline void Scheduler::Suspend(ScheduledRoutine& routine) {
     auto& context = m_contexts[routine.GetContextId()];
-    auto lock = boost::lock_guard(context.m_mutex);
-    routine.SetState(Routine::State::SUSPENDED);
-    if(routine.IsPendingResume()) {
+    auto isPinned = routine.IsPinned();
+    {
+      auto lock = boost::lock_guard(context.m_mutex);
+      routine.SetState(Routine::State::SUSPENDED);
+      if(!routine.IsPendingResume()) {
+        context.m_suspendedRoutines.insert(&routine);
+        return;
+      }
       routine.SetPendingResume(false);
-      context.m_pendingRoutines.push_back(&routine);
-      context.m_pendingRoutinesAvailableCondition.notify_all();
-      return;
+      Push(context, routine);
+    }
+    if(!isPinned) {
+      RequestSteal(context);
     }
-    context.m_suspendedRoutines.insert(&routine);
   }
 
   inline void Scheduler::Resume(ScheduledRoutine& routine) {
     auto& context = m_contexts[routine.GetContextId()];
-    auto lock = boost::lock_guard(context.m_mutex);
-    auto routineIterator = context.m_suspendedRoutines.find(&routine);
-    if(routineIterator == context.m_suspendedRoutines.end()) {
-      routine.SetPendingResume(true);
-      return;
+    auto isPinned = routine.IsPinned();
+    {
+      auto lock = boost::lock_guard(context.m_mutex);
+      auto routineIterator = context.m_suspendedRoutines.find(&routine);
+      if(routineIterator == context.m_suspendedRoutines.end()) {
+        routine.SetPendingResume(true);
+        return;
+      }
+      context.m_suspendedRoutines.erase(routineIterator);
+      Push(context, routine);
+    }
+    if(!isPinned) {
+      RequestSteal(context);
     }
-    context.m_suspendedRoutines.erase(routineIterator);
+  }
+
+  inline void Scheduler::Push(Context& context, ScheduledRoutine& routine) {
+    routine.m_queueTimestamp = std::chrono::steady_clock::now();
     context.m_pendingRoutines.push_back(&routine);
-    context.m_pendingRoutinesAvailableCondition.notify_all();
+    UpdatePendingCount(context);
+    if(context.m_pendingRoutines.size() == 1 &&
+        context.m_continuations.empty()) {
+      context.m_pendingRoutinesAvailableCondition.notify_all();
+    }
+  }
+
+  inline void Scheduler::UpdatePendingCount(Context& context) {
+    context.m_pendingCount.store(context.m_pendingRoutines.size() +
+      context.m_continuations.size(), std::memory_order_relaxed);
+  }
+
+  inline void Scheduler::RequestSteal(const Context& source) {
+    if(!m_isWorkStealing || m_idleCount == 0) {
+      return;
+    }
+    for(auto i = std::size_t(1); i < m_threadCount; ++i) {
+      auto& context = m_contexts[(source.m_id + i) % m_threadCount];
+      if(context.m_isIdle) {
+        auto lock = boost::lock_guard(context.m_mutex);
+        context.m_isStealRequested = true;
+        context.m_pendingRoutinesAvailableCondition.notify_all();
+        return;
+      }
+    }
+  }
+
+  inline ScheduledRoutine* Scheduler::Steal(Context& context) {
+    for(auto i = std::size_t(1); i < m_threadCount; ++i) {
+      auto& victim = m_contexts[(context.m_id + i) % m_threadCount];
+      auto lock = boost::lock_guard(victim.m_mutex);
+      for(auto j = victim.m_pendingRoutines.rbegin();
+          j != victim.m_pendingRoutines.rend(); ++j) {
+        auto routine = *j;
+        if(!routine->IsPinned()) {
+          victim.m_pendingRoutines.erase(std::next(j).base());
+          UpdatePendingCount(victim);
+          routine->m_contextId = context.m_id;
+          return routine;
+        }
+      }
+    }
+    return nullptr;
   }
 
   inline void Scheduler::Stop() {
@@ -206,26 +485,101 @@ namespace Details {
     }
   }
 
+  inline void Scheduler::Record(Context& context,
+      const ScheduledRoutine& routine,
+      std::chrono::steady_clock::time_point start,
+      std::chrono::steady_clock::time_point end) {
+    auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+      start - routine.m_queueTimestamp).count();
+    auto bucket = std::size_t(0);
+    while(latency > 0 && bucket + 1 < LATENCY_BUCKET_COUNT) {
+      latency >>= 1;
+      ++bucket;
+    }
+    auto& count = context.m_latencies[bucket];
+    count.store(count.load(std::memory_order_relaxed) + 1,
+      std::memory_order_relaxed);
+    context.m_contextSwitches.store(context.m_contextSwitches.load(
+      std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    auto slice = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      end - start).count();
+    if(slice > context.m_longestSlice.load(std::memory_order_relaxed)) {
+      context.m_longestSlice.store(slice, std::memory_order_relaxed);
+    }
+  }
+
   inline void Scheduler::Run(Context& context) {
+    auto continuations = std::vector<Continuation>();
     while(true) {
       auto routine = static_cast<ScheduledRoutine*>(nullptr);
       {
         auto lock = boost::unique_lock(context.m_mutex);
-        while(context.m_pendingRoutines.empty()) {
-          if(!context.m_isRunning && context.m_pendingRoutines.empty() &&
-              context.m_suspendedRoutines.empty()) {
+        auto hasSpun = false;
+        while(context.m_pendingRoutines.empty() &&
+            context.m_continuations.empty()) {
+          if(!context.m_isRunning && context.m_suspendedRoutines.empty()) {
             return;
           }
-          context.m_pendingRoutinesAvailableCondition.wait(lock);
+          if(!hasSpun && m_spinDuration > boost::posix_time::seconds(0)) {
+            hasSpun = true;
+            lock.unlock();
+            Threading::SpinWait(m_spinDuration, [&] {
+              return context.m_pendingCount.load(
+                std::memory_order_relaxed) != 0;
+            });
+            lock.lock();
+            continue;
+          }
+          if(m_isWorkStealing && m_threadCount > 1) {
+            context.m_isStealRequested = false;
+            context.m_isIdle = true;
+            ++m_idleCount;
+            lock.unlock();
+            routine = Steal(context);
+            lock.lock();
+            if(routine) {
+              context.m_isIdle = false;
+              --m_idleCount;
+              context.m_steals.store(context.m_steals.load(
+                std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+              break;
+            }
+            if(context.m_isStealRequested ||
+                !context.m_pendingRoutines.empty() ||
+                !context.m_continuations.empty()) {
+              context.m_isIdle = false;
+              --m_idleCount;
+              continue;
+            }
+            context.m_pendingRoutinesAvailableCondition.wait(lock);
+            context.m_isIdle = false;
+            --m_idleCount;
+          } else {
+            context.m_pendingRoutinesAvailableCondition.wait(lock);
+          }
         }
-        routine = context.m_pendingRoutines.front();
-        context.m_pendingRoutines.pop_front();
+        continuations.swap(context.m_continuations);
+        if(!routine && !context.m_pendingRoutines.empty()) {
+          routine = context.m_pendingRoutines.front();
+          context.m_pendingRoutines.pop_front();
+        }
+        UpdatePendingCount(context);
+      }
+      for(auto& continuation : continuations) {
+        continuation.m_callback(continuation.m_argument);
       }
+      continuations.clear();
+      if(!routine) {
+        continue;
+      }
+      auto start = std::chrono::steady_clock::now();
       routine->Continue();
+      Record(context, *routine, start, std::chrono::steady_clock::now());
       if(routine->GetState() == Routine::State::COMPLETE) {
-        Threading::With(m_routineIds, [&] (auto& routineIds) {
-          routineIds.erase(routine->GetId());
-        });
+        Threading::With(GetRoutineIds(routine->GetId()),
+          [&] (auto& routineIds) {
+            routineIds.erase(routine->GetId());
+          });
         delete routine;
       } else if(routine->GetState() == Routine::State::PENDING_SUSPEND) {
         Suspend(*routine);
@@ -252,6 +606,24 @@ namespace Details {
     return Spawn(std::forward<F>(f), Details::Scheduler::DEFAULT_STACK_SIZE);
   }
 
+  /**
+   * Sets the configuration used by the Scheduler, must be called before any
+   * Routine is spawned.
+   * @param config The thread count, CPU affinity and idle strategy to use.
+   */
+  inline void SetSchedulerConfig(const Threading::ThreadPoolConfig& config) {
+    Details::Scheduler::SetConfig(config);
+  }
+
+  /**
+   * Sets whether idle Scheduler threads steal Routines from other contexts.
+   * @param isWorkStealing <code>true</code> iff idle threads should steal
+   *        pending Routines that are not pinned to a context.
+   */
+  inline void SetWorkStealing(bool isWorkStealing) {
+    Details::Scheduler::GetInstance().SetWorkStealing(isWorkStealing);
+  }
+
   template<typename F>
   Routine::Id Spawn(F&& f, std::size_t stackSize, std::size_t contextId,
       Eval<std::remove_reference_t<decltype(f())>> result) {
@@ -289,6 +661,24 @@ namespace Details {
     Details::Scheduler::GetInstance().Wait(id);
   }
 
+  inline void ScheduledRoutine::Continue() {
+    Details::CurrentRoutineGlobal<void>::GetInstance() = this;
+    m_isPendingResume = false;
+    if(GetState() == State::PENDING) {
+      SetState(State::RUNNING);
+      m_continuation = boost::context::callcc(std::allocator_arg,
+        Details::Scheduler::GetInstance().GetStackPool().GetAllocator(
+          m_stackSize),
+        [=] (boost::context::continuation&& parent) {
+          return InitializeRoutine(std::move(parent));
+        });
+    } else {
+      SetState(State::RUNNING);
+      m_continuation = m_continuation.resume();
+    }
+    Details::CurrentRoutineGlobal<void>::GetInstance() = nullptr;
+  }
+
   inline void ScheduledRoutine::Resume() {
     Details::Scheduler::GetInstance().Resume(*this);
   }
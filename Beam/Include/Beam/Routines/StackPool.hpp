@@ -0,0 +1,301 @@
+#ifndef BEAM_STACK_POOL_HPP
+#define BEAM_STACK_POOL_HPP
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <boost/context/fixedsize_stack.hpp>
+#include <boost/context/protected_fixedsize_stack.hpp>
+#include <boost/context/stack_context.hpp>
+#include <boost/context/stack_traits.hpp>
+#include <boost/thread/mutex.hpp>
+#include "Beam/Pointers/Ref.hpp"
+#include "Beam/Routines/Routines.hpp"
+
+#ifndef BEAM_SCHEDULER_DEFAULT_STACK_RETENTION
+  #define BEAM_SCHEDULER_DEFAULT_STACK_RETENTION 67108864
+#endif
+
+namespace Beam::Routines {
+
+  /**
+   * Caches the stacks of completed Routines grouped by size class so that
+   * they can be reused by newly spawned Routines.
+   */
+  class StackPool {
+    public:
+
+      /** The default number of bytes a StackPool retains. */
+      static constexpr std::size_t DEFAULT_RETENTION =
+        BEAM_SCHEDULER_DEFAULT_STACK_RETENTION;
+
+      /** Stores a snapshot of a StackPool's counters. */
+      struct Statistics {
+
+        /** The number of stacks requested from the pool. */
+        std::uint64_t m_allocations;
+
+        /** The number of requests served by reusing a retained stack. */
+        std::uint64_t m_hits;
+
+        /** The number of stacks returned to the pool and retained. */
+        std::uint64_t m_recycles;
+
+        /** The number of stacks released because the pool was full. */
+        std::uint64_t m_evictions;
+
+        /** The number of stacks currently retained. */
+        std::size_t m_retainedStacks;
+
+        /** The number of bytes currently retained. */
+        std::size_t m_retainedBytes;
+      };
+
+      /** Implements boost::context's StackAllocator using a StackPool. */
+      class Allocator {
+        public:
+
+          /**
+           * Constructs an Allocator.
+           * @param pool The StackPool to draw stacks from.
+           * @param size The minimum size of the stack to allocate.
+           */
+          Allocator(Ref<StackPool> pool, std::size_t size);
+
+          /** Allocates a stack from the pool. */
+          boost::context::stack_context allocate();
+
+          /**
+           * Returns a stack to the pool.
+           * @param context The stack to return.
+           */
+          void deallocate(boost::context::stack_context& context);
+
+        private:
+          StackPool* m_pool;
+          std::size_t m_size;
+          bool m_hasGuardPage;
+      };
+
+      /**
+       * Constructs a StackPool.
+       * @param retention The maximum number of bytes to retain.
+       * @param hasGuardPages Whether stacks are allocated with a guard page.
+       */
+      StackPool(std::size_t retention, bool hasGuardPages);
+
+      ~StackPool();
+
+      /** Returns the maximum number of bytes to retain. */
+      std::size_t GetRetention() const;
+
+      /**
+       * Sets the maximum number of bytes to retain. Stacks retained beyond
+       * the new limit are released as they are returned.
+       * @param retention The maximum number of bytes to retain.
+       */
+      void SetRetention(std::size_t retention);
+
+      /**
+       * Returns <code>true</code> iff newly allocated stacks are protected by
+       * a guard page.
+       */
+      bool HasGuardPages() const;
+
+      /**
+       * Sets whether newly allocated stacks are protected by a guard page.
+       * @param hasGuardPages <code>true</code> iff stacks should be allocated
+       *        with a guard page.
+       */
+      void SetGuardPages(bool hasGuardPages);
+
+      /** Returns a snapshot of this pool's counters. */
+      Statistics GetStatistics() const;
+
+      /**
+       * Returns an Allocator that draws from this pool.
+       * @param size The minimum size of the stack to allocate.
+       */
+      Allocator GetAllocator(std::size_t size);
+
+      /** Releases all retained stacks. */
+      void Clear();
+
+    private:
+      struct SizeClass {
+        std::vector<boost::context::stack_context> m_stacks;
+        std::vector<boost::context::stack_context> m_guardedStacks;
+      };
+      static constexpr auto SIZE_CLASS_COUNT = 8 * sizeof(std::size_t);
+      std::atomic_size_t m_retention;
+      std::atomic_bool m_hasGuardPages;
+      std::atomic_uint64_t m_allocations;
+      std::atomic_uint64_t m_hits;
+      std::atomic_uint64_t m_recycles;
+      std::atomic_uint64_t m_evictions;
+      std::atomic_size_t m_retainedStacks;
+      std::atomic_size_t m_retainedBytes;
+      boost::mutex m_mutex;
+      std::array<SizeClass, SIZE_CLASS_COUNT> m_sizeClasses;
+
+      StackPool(const StackPool&) = delete;
+      StackPool& operator =(const StackPool&) = delete;
+      static std::size_t GetSizeClass(std::size_t size);
+      boost::context::stack_context Allocate(std::size_t size,
+        bool hasGuardPage);
+      void Deallocate(boost::context::stack_context& context, std::size_t size,
+        bool hasGuardPage);
+      static void Release(boost::context::stack_context& context,
+        bool hasGuardPage);
+  };
+
+  inline StackPool::Allocator::Allocator(Ref<StackPool> pool,
+    std::size_t size)
+    : m_pool(pool.Get()),
+      m_size(size),
+      m_hasGuardPage(m_pool->HasGuardPages()) {}
+
+  inline boost::context::stack_context StackPool::Allocator::allocate() {
+    return m_pool->Allocate(m_size, m_hasGuardPage);
+  }
+
+  inline void StackPool::Allocator::deallocate(
+      boost::context::stack_context& context) {
+    m_pool->Deallocate(context, m_size, m_hasGuardPage);
+  }
+
+  inline StackPool::StackPool(std::size_t retention, bool hasGuardPages)
+    : m_retention(retention),
+      m_hasGuardPages(hasGuardPages),
+      m_allocations(0),
+      m_hits(0),
+      m_recycles(0),
+      m_evictions(0),
+      m_retainedStacks(0),
+      m_retainedBytes(0) {}
+
+  inline StackPool::~StackPool() {
+    Clear();
+  }
+
+  inline std::size_t StackPool::GetRetention() const {
+    return m_retention;
+  }
+
+  inline void StackPool::SetRetention(std::size_t retention) {
+    m_retention = retention;
+  }
+
+  inline bool StackPool::HasGuardPages() const {
+    return m_hasGuardPages;
+  }
+
+  inline void StackPool::SetGuardPages(bool hasGuardPages) {
+    m_hasGuardPages = hasGuardPages;
+  }
+
+  inline StackPool::Statistics StackPool::GetStatistics() const {
+    auto statistics = Statistics();
+    statistics.m_allocations = m_allocations;
+    statistics.m_hits = m_hits;
+    statistics.m_recycles = m_recycles;
+    statistics.m_evictions = m_evictions;
+    statistics.m_retainedStacks = m_retainedStacks;
+    statistics.m_retainedBytes = m_retainedBytes;
+    return statistics;
+  }
+
+  inline StackPool::Allocator StackPool::GetAllocator(std::size_t size) {
+    return Allocator(Ref(*this), size);
+  }
+
+  inline void StackPool::Clear() {
+    auto stacks = std::vector<boost::context::stack_context>();
+    auto guardedStacks = std::vector<boost::context::stack_context>();
+    {
+      auto lock = boost::lock_guard(m_mutex);
+      for(auto& sizeClass : m_sizeClasses) {
+        stacks.insert(stacks.end(), sizeClass.m_stacks.begin(),
+          sizeClass.m_stacks.end());
+        sizeClass.m_stacks.clear();
+        guardedStacks.insert(guardedStacks.end(),
+          sizeClass.m_guardedStacks.begin(), sizeClass.m_guardedStacks.end());
+        sizeClass.m_guardedStacks.clear();
+      }
+      m_retainedBytes = 0;
+      m_retainedStacks = 0;
+    }
+    for(auto& stack : stacks) {
+      Release(stack, false);
+    }
+    for(auto& stack : guardedStacks) {
+      Release(stack, true);
+    }
+  }
+
+  inline std::size_t StackPool::GetSizeClass(std::size_t size) {
+    auto sizeClass = std::size_t(0);
+    while((std::size_t(1) << sizeClass) < size &&
+        sizeClass + 1 < SIZE_CLASS_COUNT) {
+      ++sizeClass;
+    }
+    return sizeClass;
+  }
+
+  inline boost::context::stack_context StackPool::Allocate(std::size_t size,
+      bool hasGuardPage) {
+    ++m_allocations;
+    auto sizeClass = GetSizeClass(std::max(size,
+      boost::context::stack_traits::minimum_size()));
+    auto& stacks = m_sizeClasses[sizeClass];
+    {
+      auto lock = boost::lock_guard(m_mutex);
+      auto& pool = hasGuardPage ? stacks.m_guardedStacks : stacks.m_stacks;
+      if(!pool.empty()) {
+        auto stack = pool.back();
+        pool.pop_back();
+        m_retainedBytes -= stack.size;
+        --m_retainedStacks;
+        ++m_hits;
+        return stack;
+      }
+    }
+    auto classSize = std::size_t(1) << sizeClass;
+    if(hasGuardPage) {
+      return boost::context::protected_fixedsize_stack(classSize).allocate();
+    }
+    return boost::context::fixedsize_stack(classSize).allocate();
+  }
+
+  inline void StackPool::Deallocate(boost::context::stack_context& context,
+      std::size_t size, bool hasGuardPage) {
+    auto sizeClass = GetSizeClass(std::max(size,
+      boost::context::stack_traits::minimum_size()));
+    auto& stacks = m_sizeClasses[sizeClass];
+    {
+      auto lock = boost::lock_guard(m_mutex);
+      if(m_retainedBytes + context.size <= m_retention) {
+        auto& pool = hasGuardPage ? stacks.m_guardedStacks : stacks.m_stacks;
+        pool.push_back(context);
+        m_retainedBytes += context.size;
+        ++m_retainedStacks;
+        ++m_recycles;
+        return;
+      }
+    }
+    ++m_evictions;
+    Release(context, hasGuardPage);
+  }
+
+  inline void StackPool::Release(boost::context::stack_context& context,
+      bool hasGuardPage) {
+    if(hasGuardPage) {
+      boost::context::protected_fixedsize_stack().deallocate(context);
+    } else {
+      boost::context::fixedsize_stack().deallocate(context);
+    }
+  }
+}
+
+#endif
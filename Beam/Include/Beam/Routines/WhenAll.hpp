@@ -0,0 +1,39 @@
+#ifndef BEAM_WHEN_ALL_HPP
+#define BEAM_WHEN_ALL_HPP
+#include <array>
+#include <vector>
+#include "Beam/Routines/Async.hpp"
+#include "Beam/Routines/Routine.hpp"
+#include "Beam/Routines/Routines.hpp"
+
+namespace Beam::Routines {
+
+  /**
+   * Suspends the current Routine until every Async has completed, either with
+   * a result or an exception.
+   * @param asyncs The Asyncs to wait for.
+   */
+  template<typename... T>
+  void WhenAll(Async<T>&... asyncs) {
+    auto observed = std::array<BaseAsync*, sizeof...(T)>{&asyncs...};
+    Details::Await(observed.size(), observed.size(),
+      [&] (auto index) -> BaseAsync& {
+        return *observed[index];
+      });
+  }
+
+  /**
+   * Suspends the current Routine until every Async has completed, either with
+   * a result or an exception.
+   * @param asyncs The Asyncs to wait for.
+   */
+  template<typename T>
+  void WhenAll(std::vector<Async<T>>& asyncs) {
+    Details::Await(asyncs.size(), asyncs.size(),
+      [&] (auto index) -> BaseAsync& {
+        return asyncs[index];
+      });
+  }
+}
+
+#endif
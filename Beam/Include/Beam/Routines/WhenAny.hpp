@@ -0,0 +1,44 @@
+#ifndef BEAM_WHEN_ANY_HPP
+#define BEAM_WHEN_ANY_HPP
+#include <array>
+#include <cassert>
+#include <vector>
+#include "Beam/Routines/Async.hpp"
+#include "Beam/Routines/Routine.hpp"
+#include "Beam/Routines/Routines.hpp"
+
+namespace Beam::Routines {
+
+  /**
+   * Suspends the current Routine until at least one Async has completed,
+   * either with a result or an exception.
+   * @param asyncs The Asyncs to wait for.
+   * @return The index of the first Async found to have completed.
+   */
+  template<typename... T>
+  std::size_t WhenAny(Async<T>&... asyncs) {
+    static_assert(sizeof...(T) != 0);
+    auto observed = std::array<BaseAsync*, sizeof...(T)>{&asyncs...};
+    return Details::Await(observed.size(), 1,
+      [&] (auto index) -> BaseAsync& {
+        return *observed[index];
+      });
+  }
+
+  /**
+   * Suspends the current Routine until at least one Async has completed,
+   * either with a result or an exception.
+   * @param asyncs The Asyncs to wait for, must not be empty.
+   * @return The index of the first Async found to have completed.
+   */
+  template<typename T>
+  std::size_t WhenAny(std::vector<Async<T>>& asyncs) {
+    assert(!asyncs.empty());
+    return Details::Await(asyncs.size(), 1,
+      [&] (auto index) -> BaseAsync& {
+        return asyncs[index];
+      });
+  }
+}
+
+#endif
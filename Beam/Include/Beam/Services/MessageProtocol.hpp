@@ -8,6 +8,7 @@
 #include "Beam/Codecs/NullDecoder.hpp"
 #include "Beam/Codecs/NullEncoder.hpp"
 #include "Beam/IO/AsyncWriter.hpp"
+#include "Beam/IO/BufferedReader.hpp"
 #include "Beam/IO/BufferSlice.hpp"
 #include "Beam/IO/OpenState.hpp"
 #include "Beam/IO/SharedBuffer.hpp"
@@ -48,6 +49,12 @@ namespace Beam::Services {
       /** The type of Decoder used. */
       using Decoder = Codecs::GetInverse<Encoder>;
 
+      /** The type of BufferedReader used to receive messages. */
+      using Reader = IO::BufferedReader<typename Channel::Reader*>;
+
+      /** The type of AsyncWriter used to send messages. */
+      using Writer = IO::AsyncWriter<typename Channel::Writer*>;
+
       /**
        * Constructs a MessageProtocol.
        * @param channel The Channel to adapt this protocol onto.
@@ -62,6 +69,12 @@ namespace Beam::Services {
 
       ~MessageProtocol();
 
+      /** Returns the Statistics of the BufferedReader receiving messages. */
+      typename Reader::Statistics GetReaderStatistics() const;
+
+      /** Returns the Statistics of the AsyncWriter used to send messages. */
+      typename Writer::Statistics GetWriterStatistics() const;
+
       /**
        * Clones a value using this protocol's serializer.
        * @param value The value to clone.
@@ -105,7 +118,8 @@ namespace Beam::Services {
       mutable boost::mutex m_mutex;
       IO::OpenState m_openState;
       GetOptionalLocalPtr<C> m_channel;
-      IO::AsyncWriter<typename Channel::Writer*> m_writer;
+      Reader m_reader;
+      Writer m_writer;
       LocalPtr<Sender> m_sender;
       LocalPtr<Receiver> m_receiver;
       LocalPtr<Encoder> m_encoder;
@@ -115,6 +129,7 @@ namespace Beam::Services {
 
       MessageProtocol(const MessageProtocol&) = delete;
       MessageProtocol& operator =(const MessageProtocol&) = delete;
+      static IO::AsyncWriterOptions MakeWriterOptions();
   };
 
   template<typename C, typename S, typename E>
@@ -122,7 +137,8 @@ namespace Beam::Services {
   MessageProtocol<C, S, E>::MessageProtocol(CF&& channel, SF&& sender,
     RF&& receiver, EF&& encoder, DF&& decoder)
     : m_channel(std::forward<CF>(channel)),
-      m_writer(&m_channel->GetWriter()),
+      m_reader(&m_channel->GetReader()),
+      m_writer(&m_channel->GetWriter(), MakeWriterOptions()),
       m_sender(std::forward<SF>(sender)),
       m_receiver(std::forward<RF>(receiver)),
       m_encoder(std::forward<EF>(encoder)),
@@ -133,6 +149,18 @@ namespace Beam::Services {
     Close();
   }
 
+  template<typename C, typename S, typename E>
+  typename MessageProtocol<C, S, E>::Reader::Statistics
+      MessageProtocol<C, S, E>::GetReaderStatistics() const {
+    return m_reader.GetStatistics();
+  }
+
+  template<typename C, typename S, typename E>
+  typename MessageProtocol<C, S, E>::Writer::Statistics
+      MessageProtocol<C, S, E>::GetWriterStatistics() const {
+    return m_writer.GetStatistics();
+  }
+
   template<typename C, typename S, typename E>
   template<typename T>
   std::unique_ptr<T> MessageProtocol<C, S, E>::Clone(const T& value) {
@@ -203,13 +231,13 @@ namespace Beam::Services {
       auto size = std::uint32_t(0);
       auto remainingSizeRead = sizeof(std::uint32_t);
       while(remainingSizeRead != 0) {
-        remainingSizeRead -= m_channel->GetReader().Read(
+        remainingSizeRead -= m_reader.Read(
           reinterpret_cast<char*>(&size) +
           (sizeof(std::uint32_t) - remainingSizeRead), remainingSizeRead);
       }
       size = FromLittleEndian<std::uint32_t>(size);
       while(size > m_receiveBuffer.GetSize()) {
-        m_channel->GetReader().Read(Store(m_receiveBuffer),
+        m_reader.Read(Store(m_receiveBuffer),
           size - m_receiveBuffer.GetSize());
       }
       if(Codecs::InPlaceSupport<Decoder>::value) {
@@ -241,6 +269,14 @@ namespace Beam::Services {
     m_channel->GetConnection().Close();
     m_openState.Close();
   }
+
+  template<typename C, typename S, typename E>
+  IO::AsyncWriterOptions MessageProtocol<C, S, E>::MakeWriterOptions() {
+    auto options = IO::AsyncWriterOptions();
+    options.m_isCoalescing =
+      IO::VectoredWriteSupport<typename Channel::Writer>::value;
+    return options;
+  }
 }
 
 #endif
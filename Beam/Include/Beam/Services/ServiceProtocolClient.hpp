@@ -96,6 +96,9 @@ namespace Details {
       /** Returns the session info. */
       Session& GetSession();
 
+      /** Returns the MessageProtocol used to send and receive messages. */
+      const MessageProtocol& GetMessageProtocol() const;
+
       /**
        * Clones a ServiceRequestException usable with this protocol.
        * @param e The ServiceRequestException to clone.
@@ -276,6 +279,12 @@ namespace Details {
     return m_session;
   }
 
+  template<typename M, typename T, typename P, typename S, bool V>
+  const typename ServiceProtocolClient<M, T, P, S, V>::MessageProtocol&
+      ServiceProtocolClient<M, T, P, S, V>::GetMessageProtocol() const {
+    return m_protocol;
+  }
+
   template<typename M, typename T, typename P, typename S, bool V>
   std::unique_ptr<ServiceRequestException> ServiceProtocolClient<
       M, T, P, S, V>::CloneException(const ServiceRequestException& e) {
@@ -1,58 +1,214 @@
 #ifndef BEAM_SERVICE_THREAD_POOL_HPP
 #define BEAM_SERVICE_THREAD_POOL_HPP
+#include <atomic>
 #include <memory>
+#include <vector>
 #include <boost/asio/io_service.hpp>
 #include <boost/thread/thread.hpp>
 #include "Beam/Network/Network.hpp"
+#include "Beam/Routines/Scheduler.hpp"
+#include "Beam/Threading/ThreadAffinity.hpp"
+#include "Beam/Threading/ThreadPoolConfig.hpp"
 #include "Beam/Threading/Threading.hpp"
 #include "Beam/Utilities/Singleton.hpp"
 
 namespace Beam::Threading {
 
-  /** Wraps a list of ASIO worker threads. */
+  /**
+   * Wraps a list of ASIO worker threads. By default every thread runs the
+   * same io_service, in sharded mode each thread runs its own io_service and
+   * every socket is bound to one of them for its lifetime.
+   */
   class ServiceThreadPool : public Singleton<ServiceThreadPool> {
     public:
+
+      /** Indicates that a shard should be assigned in round-robin order. */
+      static constexpr auto ANY_SHARD = static_cast<std::size_t>(-1);
+
+      /**
+       * Constructs a ServiceThreadPool independent of the shared instance.
+       * @param config The thread count, CPU affinity and idle strategy to use.
+       * @param isSharded <code>true</code> iff each thread should run its own
+       *        io_service rather than all threads sharing one.
+       * @throws std::system_error If a thread can not be pinned to its CPU.
+       */
+      ServiceThreadPool(const ThreadPoolConfig& config, bool isSharded);
+
       ~ServiceThreadPool();
 
+      /**
+       * Sets the configuration used to construct the ServiceThreadPool, must
+       * be called before the ServiceThreadPool is first used.
+       * @param config The thread count, CPU affinity and idle strategy to use.
+       */
+      static void SetConfig(const ThreadPoolConfig& config);
+
+      /**
+       * Sets whether each thread runs its own io_service, must be called
+       * before the ServiceThreadPool is first used.
+       * @param isSharded <code>true</code> iff each thread should run its own
+       *        io_service rather than all threads sharing one.
+       */
+      static void SetSharded(bool isSharded);
+
+      /** Returns the number of threads running the service. */
+      std::size_t GetThreadCount() const;
+
+      /** Returns the number of io_services that sockets are spread across. */
+      std::size_t GetShardCount() const;
+
+      /**
+       * Returns the shard whose thread has the same index as the calling
+       * Routine's Scheduler context, or ANY_SHARD when not called from a
+       * scheduled Routine. When the Scheduler and the ServiceThreadPool are
+       * pinned to the same CPUs, a socket on this shard has its handlers run
+       * on the CPU of the Routine consuming it.
+       */
+      std::size_t GetLocalShard() const;
+
     private:
       friend class Beam::Network::MulticastSocket;
       friend class Beam::Network::SecureSocketChannel;
+      friend class Beam::Network::SharedMemoryChannel;
+      friend class Beam::Network::SharedMemoryServerConnection;
       friend class Beam::Network::TcpServerSocket;
       friend class Beam::Network::TcpSocketChannel;
       friend class Beam::Network::UdpSocket;
       friend class LiveTimer;
       friend class Singleton<ServiceThreadPool>;
-      boost::asio::io_service m_service;
-      boost::asio::io_service::work m_work;
+      struct Shard {
+        boost::asio::io_service m_service;
+        boost::asio::io_service::work m_work;
+
+        Shard();
+      };
       std::size_t m_threadCount;
+      boost::posix_time::time_duration m_spinDuration;
+      std::vector<std::unique_ptr<Shard>> m_shards;
+      std::atomic_size_t m_nextShard;
       std::unique_ptr<boost::thread[]> m_threads;
 
       ServiceThreadPool();
+      static ThreadPoolConfig& GetConfig();
+      static bool& GetIsSharded();
       ServiceThreadPool(const ServiceThreadPool&) = delete;
       ServiceThreadPool& operator =(const ServiceThreadPool&) = delete;
       boost::asio::io_service& GetService();
+      boost::asio::io_service& GetService(std::size_t shard);
+      void Run(boost::asio::io_service& service);
   };
 
+  inline ServiceThreadPool::Shard::Shard()
+    : m_work(m_service) {}
+
+  inline ServiceThreadPool::ServiceThreadPool(const ThreadPoolConfig& config,
+      bool isSharded)
+      : m_threadCount(Threading::GetThreadCount(config)),
+        m_spinDuration(config.m_spinDuration),
+        m_nextShard(0),
+        m_threads(std::make_unique<boost::thread[]>(m_threadCount)) {
+    auto shardCount = isSharded ? m_threadCount : 1;
+    for(auto i = std::size_t(0); i < shardCount; ++i) {
+      m_shards.push_back(std::make_unique<Shard>());
+    }
+    for(auto i = std::size_t(0); i < m_threadCount; ++i) {
+      auto& service = m_shards[i % shardCount]->m_service;
+      m_threads[i] = boost::thread([=, &service] {
+        Run(service);
+      });
+    }
+    try {
+      for(auto i = std::size_t(0); i < m_threadCount; ++i) {
+        Pin(m_threads[i], config, i);
+      }
+    } catch(const std::exception&) {
+      for(auto& shard : m_shards) {
+        shard->m_service.stop();
+      }
+      for(auto i = std::size_t(0); i < m_threadCount; ++i) {
+        m_threads[i].join();
+      }
+      throw;
+    }
+  }
+
   inline ServiceThreadPool::~ServiceThreadPool() {
-    m_service.stop();
+    for(auto& shard : m_shards) {
+      shard->m_service.stop();
+    }
     for(auto i = std::size_t(0); i < m_threadCount; ++i) {
       m_threads[i].join();
     }
   }
 
-  inline ServiceThreadPool::ServiceThreadPool()
-      : m_work(m_service),
-        m_threadCount(boost::thread::hardware_concurrency()),
-        m_threads(std::make_unique<boost::thread[]>(m_threadCount)) {
-    for(auto i = std::size_t(0); i < m_threadCount; ++i) {
-      m_threads[i] = boost::thread([=] {
-        m_service.run();
-      });
+  inline void ServiceThreadPool::SetConfig(const ThreadPoolConfig& config) {
+    GetConfig() = config;
+  }
+
+  inline void ServiceThreadPool::SetSharded(bool isSharded) {
+    GetIsSharded() = isSharded;
+  }
+
+  inline std::size_t ServiceThreadPool::GetThreadCount() const {
+    return m_threadCount;
+  }
+
+  inline std::size_t ServiceThreadPool::GetShardCount() const {
+    return m_shards.size();
+  }
+
+  inline std::size_t ServiceThreadPool::GetLocalShard() const {
+    auto routine =
+      dynamic_cast<Routines::ScheduledRoutine*>(&Routines::GetCurrentRoutine());
+    if(routine == nullptr) {
+      return ANY_SHARD;
     }
+    return routine->GetContextId() % m_shards.size();
+  }
+
+  inline ServiceThreadPool::ServiceThreadPool()
+    : ServiceThreadPool(GetConfig(), GetIsSharded()) {}
+
+  inline ThreadPoolConfig& ServiceThreadPool::GetConfig() {
+    static auto config = ThreadPoolConfig();
+    return config;
+  }
+
+  inline bool& ServiceThreadPool::GetIsSharded() {
+    static auto isSharded = false;
+    return isSharded;
   }
 
   inline boost::asio::io_service& ServiceThreadPool::GetService() {
-    return m_service;
+    return GetService(ANY_SHARD);
+  }
+
+  inline boost::asio::io_service& ServiceThreadPool::GetService(
+      std::size_t shard) {
+    if(m_shards.size() == 1) {
+      return m_shards.front()->m_service;
+    }
+    if(shard == ANY_SHARD) {
+      shard = m_nextShard.fetch_add(1, std::memory_order_relaxed);
+    }
+    return m_shards[shard % m_shards.size()]->m_service;
+  }
+
+  inline void ServiceThreadPool::Run(boost::asio::io_service& service) {
+    if(m_spinDuration <= boost::posix_time::seconds(0)) {
+      service.run();
+      return;
+    }
+    while(!service.stopped()) {
+      if(service.poll() != 0) {
+        continue;
+      }
+      if(!SpinWait(m_spinDuration, [&] {
+          return service.poll() != 0;
+        })) {
+        service.run_one();
+      }
+    }
   }
 }
 
@@ -0,0 +1,190 @@
+#ifndef BEAM_TASK_HPP
+#define BEAM_TASK_HPP
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "Beam/Threading/Threading.hpp"
+
+namespace Beam::Threading {
+namespace Details {
+  struct TaskOperations {
+    void (*m_invoke)(void*);
+    void (*m_move)(void*, void*);
+    void (*m_destroy)(void*);
+  };
+
+  constexpr auto INLINE_TASK_SIZE = std::size_t(48);
+
+  template<typename F>
+  constexpr auto IS_INLINE_TASK = sizeof(F) <= INLINE_TASK_SIZE &&
+    alignof(F) <= alignof(std::max_align_t) &&
+    std::is_nothrow_move_constructible_v<F>;
+
+  template<typename F, bool IsInline>
+  struct TaskOperationsFor {
+    static F* Get(void* storage) {
+      return std::launder(static_cast<F*>(storage));
+    }
+
+    static void Invoke(void* storage) {
+      (*std::launder(static_cast<F*>(storage)))();
+    }
+
+    static void Move(void* destination, void* source) {
+      auto& function = *std::launder(static_cast<F*>(source));
+      new(destination) F(std::move(function));
+      function.~F();
+    }
+
+    static void Destroy(void* storage) {
+      std::launder(static_cast<F*>(storage))->~F();
+    }
+
+    static constexpr auto OPERATIONS = TaskOperations{&Invoke, &Move,
+      &Destroy};
+  };
+
+  template<typename F>
+  struct TaskOperationsFor<F, false> {
+    static F* Get(void* storage) {
+      return *std::launder(static_cast<F**>(storage));
+    }
+
+    static void Invoke(void* storage) {
+      (*Get(storage))();
+    }
+
+    static void Move(void* destination, void* source) {
+      new(destination) F*(Get(source));
+    }
+
+    static void Destroy(void* storage) {
+      delete Get(storage);
+    }
+
+    static constexpr auto OPERATIONS = TaskOperations{&Invoke, &Move,
+      &Destroy};
+  };
+}
+
+  /**
+   * Stores a move-only callable taking no arguments. Callables small enough
+   * to fit within the Task are stored inline so that constructing a Task from
+   * them does not allocate.
+   */
+  class Task {
+    public:
+
+      /** The largest callable that is stored without allocating. */
+      static constexpr auto INLINE_SIZE = Details::INLINE_TASK_SIZE;
+
+      /** Constructs an empty Task. */
+      Task() noexcept;
+
+      /**
+       * Constructs a Task.
+       * @param function The callable to store.
+       */
+      template<typename F, typename = std::enable_if_t<
+        !std::is_same_v<std::decay_t<F>, Task>>>
+      Task(F&& function);
+
+      Task(Task&& task) noexcept;
+
+      ~Task();
+
+      /** Returns <code>true</code> iff this Task stores a callable. */
+      explicit operator bool() const noexcept;
+
+      /** Invokes the stored callable. */
+      void operator ()();
+
+      /**
+       * Returns the stored callable if it is of a given type.
+       * @return The stored callable, or <code>nullptr</code> if this Task does
+       *         not store an F.
+       */
+      template<typename F>
+      F* Target() noexcept;
+
+      Task& operator =(Task&& task) noexcept;
+
+    private:
+      alignas(std::max_align_t) unsigned char m_storage[INLINE_SIZE];
+      const Details::TaskOperations* m_operations;
+
+      Task(const Task&) = delete;
+      Task& operator =(const Task&) = delete;
+      void Reset() noexcept;
+  };
+
+  inline Task::Task() noexcept
+    : m_operations(nullptr) {}
+
+  template<typename F, typename>
+  Task::Task(F&& function) {
+    using Function = std::decay_t<F>;
+    constexpr auto IS_INLINE = Details::IS_INLINE_TASK<Function>;
+    if constexpr(IS_INLINE) {
+      new(m_storage) Function(std::forward<F>(function));
+    } else {
+      new(m_storage) Function*(new Function(std::forward<F>(function)));
+    }
+    m_operations = &Details::TaskOperationsFor<Function, IS_INLINE>::OPERATIONS;
+  }
+
+  inline Task::Task(Task&& task) noexcept
+      : m_operations(task.m_operations) {
+    if(m_operations) {
+      m_operations->m_move(m_storage, task.m_storage);
+      task.m_operations = nullptr;
+    }
+  }
+
+  inline Task::~Task() {
+    Reset();
+  }
+
+  inline Task::operator bool() const noexcept {
+    return m_operations != nullptr;
+  }
+
+  inline void Task::operator ()() {
+    m_operations->m_invoke(m_storage);
+  }
+
+  template<typename F>
+  F* Task::Target() noexcept {
+    if constexpr(std::is_invocable_v<F&>) {
+      using Operations =
+        Details::TaskOperationsFor<F, Details::IS_INLINE_TASK<F>>;
+      if(m_operations == &Operations::OPERATIONS) {
+        return Operations::Get(m_storage);
+      }
+    }
+    return nullptr;
+  }
+
+  inline Task& Task::operator =(Task&& task) noexcept {
+    if(this == &task) {
+      return *this;
+    }
+    Reset();
+    if(task.m_operations) {
+      task.m_operations->m_move(m_storage, task.m_storage);
+      m_operations = task.m_operations;
+      task.m_operations = nullptr;
+    }
+    return *this;
+  }
+
+  inline void Task::Reset() noexcept {
+    if(m_operations) {
+      m_operations->m_destroy(m_storage);
+      m_operations = nullptr;
+    }
+  }
+}
+
+#endif
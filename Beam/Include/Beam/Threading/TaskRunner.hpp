@@ -1,11 +1,12 @@
 #ifndef BEAM_TASK_RUNNER_HPP
 #define BEAM_TASK_RUNNER_HPP
-#include <deque>
 #include <functional>
+#include <vector>
 #include <boost/thread/condition_variable.hpp>
 #include <boost/thread/locks.hpp>
 #include <boost/thread/mutex.hpp>
 #include "Beam/Threading/LockRelease.hpp"
+#include "Beam/Threading/Task.hpp"
 #include "Beam/Threading/Threading.hpp"
 #include "Beam/Utilities/BeamWorkaround.hpp"
 #include "Beam/Utilities/ReportException.hpp"
@@ -25,7 +26,7 @@ namespace Beam::Threading {
       ~TaskRunner();
 
       /**
-       * Adds a task.
+       * Adds a task, storing small callables without allocating.
        * @param task The task to perform.
        */
       template<typename F>
@@ -37,7 +38,8 @@ namespace Beam::Threading {
     private:
       mutable boost::mutex m_mutex;
       bool m_handlingTasks;
-      std::deque<Task> m_pendingTasks;
+      std::vector<Threading::Task> m_pendingTasks;
+      std::vector<Threading::Task> m_runningTasks;
       boost::condition_variable m_handlingTaskCondition;
 
       TaskRunner(const TaskRunner&) = delete;
@@ -73,16 +75,16 @@ namespace Beam::Threading {
   inline void TaskRunner::HandleTasks(boost::unique_lock<boost::mutex>& lock) {
     m_handlingTasks = true;
     while(!m_pendingTasks.empty()) {
-      auto task = std::move(m_pendingTasks.front());
-      m_pendingTasks.pop_front();
-      {
-        auto release = Release(lock);
+      m_runningTasks.swap(m_pendingTasks);
+      auto release = Release(lock);
+      for(auto& task : m_runningTasks) {
         try {
           task();
         } catch(const std::exception&) {
           std::cout << BEAM_REPORT_CURRENT_EXCEPTION() << std::flush;
         }
       }
+      m_runningTasks.clear();
     }
     m_handlingTasks = false;
     m_handlingTaskCondition.notify_all();
@@ -0,0 +1,88 @@
+#ifndef BEAM_THREAD_AFFINITY_HPP
+#define BEAM_THREAD_AFFINITY_HPP
+#include <chrono>
+#include <string>
+#include <system_error>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/throw_exception.hpp>
+#include "Beam/Threading/Threading.hpp"
+#include "Beam/Threading/ThreadPoolConfig.hpp"
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || \
+  defined(_M_IX86)
+  #include <immintrin.h>
+#endif
+#ifdef _WIN32
+  #include <windows.h>
+#elif defined(__linux__)
+  #include <pthread.h>
+  #include <sched.h>
+#endif
+
+namespace Beam::Threading {
+  /**
+   * Pins a pool's thread to the CPU assigned by its configuration.
+   * @param thread The thread to pin.
+   * @param config The pool's configuration.
+   * @param index The index of the <i>thread</i> within its pool.
+   * @throws std::system_error If the operating system rejects the affinity.
+   */
+  inline void Pin(boost::thread& thread, const ThreadPoolConfig& config,
+      std::size_t index) {
+    if(config.m_cpus.empty()) {
+      return;
+    }
+    auto cpu = config.m_cpus[index % config.m_cpus.size()];
+#ifdef _WIN32
+    if(::SetThreadAffinityMask(thread.native_handle(),
+        static_cast<DWORD_PTR>(1) << cpu) == 0) {
+      BOOST_THROW_EXCEPTION(std::system_error(
+        static_cast<int>(::GetLastError()), std::system_category(),
+        "Unable to pin thread to CPU " + std::to_string(cpu)));
+    }
+#elif defined(__linux__)
+    auto cpus = cpu_set_t();
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    if(auto result = ::pthread_setaffinity_np(thread.native_handle(),
+        sizeof(cpus), &cpus)) {
+      BOOST_THROW_EXCEPTION(std::system_error(result, std::generic_category(),
+        "Unable to pin thread to CPU " + std::to_string(cpu)));
+    }
+#endif
+  }
+
+  /** Hints to the processor that the calling thread is spinning. */
+  inline void Relax() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || \
+    defined(_M_IX86)
+    _mm_pause();
+#endif
+  }
+
+  /**
+   * Spins until a condition holds or a duration elapses.
+   * @param duration The maximum amount of time to spin.
+   * @param condition The condition to test.
+   * @return <code>true</code> iff the <i>condition</i> holds.
+   */
+  template<typename F>
+  bool SpinWait(boost::posix_time::time_duration duration, F&& condition) {
+    if(condition()) {
+      return true;
+    }
+    auto deadline = std::chrono::steady_clock::now() +
+      std::chrono::microseconds(duration.total_microseconds());
+    while(std::chrono::steady_clock::now() < deadline) {
+      for(auto i = 0; i < 64; ++i) {
+        if(condition()) {
+          return true;
+        }
+        Relax();
+      }
+    }
+    return condition();
+  }
+}
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef BEAM_THREAD_POOL_CONFIG_HPP
+#define BEAM_THREAD_POOL_CONFIG_HPP
+#include <algorithm>
+#include <vector>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/thread/thread.hpp>
+#include "Beam/Threading/Threading.hpp"
+
+namespace Beam::Threading {
+
+  /** Specifies how many threads a pool runs, where and how they idle. */
+  struct ThreadPoolConfig {
+
+    /** The number of threads to run, or 0 to match the system's concurrency. */
+    std::size_t m_threadCount;
+
+    /**
+     * The CPUs that threads are pinned to in round-robin order, or empty to
+     * leave threads unpinned.
+     */
+    std::vector<int> m_cpus;
+
+    /**
+     * How long an idle thread spins waiting for work before parking, zero
+     * parks immediately.
+     */
+    boost::posix_time::time_duration m_spinDuration;
+
+    /** Constructs a ThreadPoolConfig using the system's defaults. */
+    ThreadPoolConfig();
+  };
+
+  /**
+   * Returns the number of threads a pool should run.
+   * @param config The pool's configuration.
+   */
+  inline std::size_t GetThreadCount(const ThreadPoolConfig& config) {
+    if(config.m_threadCount != 0) {
+      return config.m_threadCount;
+    }
+    return std::max<std::size_t>(1, boost::thread::hardware_concurrency());
+  }
+
+  inline ThreadPoolConfig::ThreadPoolConfig()
+    : m_threadCount(0),
+      m_spinDuration(boost::posix_time::seconds(0)) {}
+}
+
+#endif
@@ -12,8 +12,10 @@ namespace Beam::Threading {
   class RecursiveMutex;
   class ServiceThreadPool;
   template<typename T, typename M> class Sync;
+  class Task;
   class TaskRunner;
   class ThreadPool;
+  struct ThreadPoolConfig;
   class TimedConditionVariable;
   class TimeoutException;
   struct Timer;
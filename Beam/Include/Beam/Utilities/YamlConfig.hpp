@@ -22,6 +22,7 @@
 #include "Beam/Parsers/ReaderParserStream.hpp"
 #include "Beam/Pointers/Out.hpp"
 #include "Beam/Serialization/DataShuttle.hpp"
+#include "Beam/Threading/ThreadPoolConfig.hpp"
 #include "Beam/Utilities/AssertionException.hpp"
 #include "Beam/Utilities/Expect.hpp"
 
@@ -297,6 +298,33 @@ namespace Beam {
       return Network::IpAddress(host, port);
     }
   };
+
+  template<>
+  struct YamlValueExtractor<Threading::ThreadPoolConfig> {
+    Threading::ThreadPoolConfig operator ()(const YAML::Node& node) const {
+      auto config = Threading::ThreadPoolConfig();
+      config.m_threadCount = Extract<std::size_t>(node, "threads",
+        config.m_threadCount);
+      config.m_cpus = Extract<std::vector<int>>(node, "cpus", config.m_cpus);
+      config.m_spinDuration = Extract<boost::posix_time::time_duration>(node,
+        "spin", config.m_spinDuration);
+      auto cpuCount = boost::thread::hardware_concurrency();
+      for(auto cpu : config.m_cpus) {
+        BEAM_ASSERT_MESSAGE(cpu >= 0 && (cpuCount == 0 ||
+          static_cast<unsigned int>(cpu) < cpuCount), "Config error at line " <<
+          (node.Mark().line + 1) << ", column " << (node.Mark().column + 1) <<
+          ":\n\tCPU " << cpu << " does not exist, the system has " <<
+          cpuCount << " CPUs." << std::endl);
+      }
+      BEAM_ASSERT_MESSAGE(
+        config.m_cpus.size() <= Threading::GetThreadCount(config),
+        "Config error at line " << (node.Mark().line + 1) << ", column " <<
+        (node.Mark().column + 1) << ":\n\t" << config.m_cpus.size() <<
+        " CPUs given for " << Threading::GetThreadCount(config) <<
+        " threads." << std::endl);
+      return config;
+    }
+  };
 }
 
 #endif
@@ -22,7 +22,8 @@ namespace WebServices {
 
       void Write(const void* data, std::size_t size);
 
-      void Write(const Buffer& data);
+      template<typename B>
+      void Write(const B& data);
 
     private:
       template<typename> friend class WebSocketChannel;
@@ -38,7 +39,8 @@ namespace WebServices {
   }
 
   template<typename WebSocketType>
-  void WebSocketWriter<WebSocketType>::Write(const Buffer& data) {
+  template<typename B>
+  void WebSocketWriter<WebSocketType>::Write(const B& data) {
     Write(data.GetData(), data.GetSize());
   }
 
@@ -48,10 +50,9 @@ namespace WebServices {
       : m_socket{socket} {}
 }
 
-  template<typename WebSocketType>
+  template<typename BufferType, typename WebSocketType>
   struct ImplementsConcept<WebServices::WebSocketWriter<WebSocketType>,
-      IO::Writer<typename WebServices::WebSocketWriter<WebSocketType>::Buffer>>
-      : std::true_type {};
+    IO::Writer<BufferType>> : std::true_type {};
 }
 
 #endif
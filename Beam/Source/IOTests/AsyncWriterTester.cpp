@@ -0,0 +1,140 @@
+#include <chrono>
+#include <string>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/IO/AsyncWriter.hpp"
+#include "Beam/IO/BufferChain.hpp"
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Routines/Async.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Routines;
+
+namespace {
+  struct BlockingWriter {
+    using Buffer = SharedBuffer;
+    std::vector<std::string> m_writes;
+    Async<void> m_started;
+    Async<void> m_release;
+
+    void Write(const void* data, std::size_t size) {
+      if(m_writes.empty()) {
+        m_started.GetEval().SetResult();
+        m_release.Get();
+      }
+      m_writes.emplace_back(static_cast<const char*>(data), size);
+    }
+
+    void Write(const BufferChain& data) {
+      auto buffer = data.Flatten();
+      Write(buffer.GetData(), buffer.GetSize());
+    }
+
+    template<typename B>
+    void Write(const B& data) {
+      Write(data.GetData(), data.GetSize());
+    }
+  };
+
+  AsyncWriterOptions MakeCoalescingOptions(std::size_t maxBytes) {
+    auto options = AsyncWriterOptions();
+    options.m_isCoalescing = true;
+    options.m_maxCoalescedBytes = maxBytes;
+    return options;
+  }
+}
+
+namespace Beam::IO {
+  template<>
+  struct VectoredWriteSupport<BlockingWriter> : std::true_type {};
+}
+
+TEST_SUITE("AsyncWriter") {
+  TEST_CASE("write") {
+    auto destination = BlockingWriter();
+    auto releaseEval = destination.m_release.GetEval();
+    auto statistics = AsyncWriter<BlockingWriter*>::Statistics();
+    {
+      auto writer = AsyncWriter(&destination);
+      writer.Write(BufferFromString<SharedBuffer>("a"));
+      destination.m_started.Get();
+      writer.Write(BufferFromString<SharedBuffer>("b"));
+      writer.Write(BufferFromString<SharedBuffer>("c"));
+      releaseEval.SetResult();
+      statistics = writer.GetStatistics();
+    }
+    REQUIRE(destination.m_writes == std::vector<std::string>{"a", "b", "c"});
+    REQUIRE(statistics.m_writes == 3);
+    REQUIRE(statistics.m_bytes == 3);
+  }
+
+  TEST_CASE("coalesce_while_in_flight") {
+    auto destination = BlockingWriter();
+    auto releaseEval = destination.m_release.GetEval();
+    auto writer = std::make_unique<AsyncWriter<BlockingWriter*>>(
+      &destination, MakeCoalescingOptions(1024));
+    writer->Write(BufferFromString<SharedBuffer>("a"));
+    destination.m_started.Get();
+    writer->Write(BufferFromString<SharedBuffer>("b"));
+    writer->Write("c", 1);
+    writer->Write(BufferChain{BufferFromString<SharedBuffer>("d"),
+      BufferFromString<SharedBuffer>("e")});
+    releaseEval.SetResult();
+    auto statistics = writer->GetStatistics();
+    writer.reset();
+    REQUIRE(destination.m_writes == std::vector<std::string>{"a", "bcde"});
+    REQUIRE(statistics.m_writes == 4);
+    REQUIRE(statistics.m_bytes == 5);
+    REQUIRE(statistics.m_flushes <= 2);
+  }
+
+  TEST_CASE("max_coalesced_bytes") {
+    auto destination = BlockingWriter();
+    auto releaseEval = destination.m_release.GetEval();
+    {
+      auto writer = AsyncWriter(&destination, MakeCoalescingOptions(2));
+      writer.Write(BufferFromString<SharedBuffer>("a"));
+      destination.m_started.Get();
+      writer.Write(BufferFromString<SharedBuffer>("b"));
+      writer.Write(BufferFromString<SharedBuffer>("c"));
+      writer.Write(BufferFromString<SharedBuffer>("d"));
+      releaseEval.SetResult();
+    }
+    REQUIRE(destination.m_writes ==
+      std::vector<std::string>{"a", "bc", "d"});
+  }
+
+  TEST_CASE("coalescing_delay") {
+    auto destination = BlockingWriter();
+    destination.m_release.GetEval().SetResult();
+    auto options = MakeCoalescingOptions(1024);
+    options.m_maxCoalescingDelay = boost::posix_time::milliseconds(1);
+    {
+      auto writer = AsyncWriter(&destination, options);
+      writer.Write(BufferFromString<SharedBuffer>("a"));
+      writer.Write(BufferFromString<SharedBuffer>("b"));
+    }
+    auto written = std::string();
+    for(auto& write : destination.m_writes) {
+      written += write;
+    }
+    REQUIRE(written == "ab");
+  }
+
+  TEST_CASE("coalescing_delay_max_bytes") {
+    auto destination = BlockingWriter();
+    destination.m_release.GetEval().SetResult();
+    auto options = MakeCoalescingOptions(2);
+    options.m_maxCoalescingDelay = boost::posix_time::seconds(10);
+    auto start = std::chrono::steady_clock::now();
+    {
+      auto writer = AsyncWriter(&destination, options);
+      writer.Write(BufferFromString<SharedBuffer>("a"));
+      writer.Write(BufferFromString<SharedBuffer>("b"));
+    }
+    REQUIRE(destination.m_writes == std::vector<std::string>{"ab"});
+    REQUIRE(std::chrono::steady_clock::now() - start <
+      std::chrono::seconds(5));
+  }
+}
@@ -0,0 +1,83 @@
+#include <string>
+#include <doctest/doctest.h>
+#include "Beam/IO/AsyncWriter.hpp"
+#include "Beam/IO/BufferChain.hpp"
+#include "Beam/IO/InlineBuffer.hpp"
+#include "Beam/IO/PipedReader.hpp"
+#include "Beam/IO/PipedWriter.hpp"
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/IO/SizeDeclarativeWriter.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+
+TEST_SUITE("BufferChain") {
+  TEST_CASE("append") {
+    auto chain = BufferChain();
+    REQUIRE(chain.IsEmpty());
+    chain.Append(BufferFromString<SharedBuffer>("hello"));
+    chain.Append(SharedBuffer());
+    chain.Append(" world", 6);
+    chain.Prepend(BufferFromString<SharedBuffer>(">"));
+    REQUIRE(chain.GetSize() == 12);
+    REQUIRE(chain.GetSegments().size() == 3);
+    REQUIRE(chain.Flatten() == ">hello world");
+    chain.Reset();
+    REQUIRE(chain.IsEmpty());
+    REQUIRE(chain.GetSegments().empty());
+  }
+
+  TEST_CASE("flatten_single_segment") {
+    auto segment = BufferFromString<SharedBuffer>("hello");
+    auto chain = BufferChain{segment};
+    REQUIRE(chain.Flatten().GetData() == segment.GetData());
+  }
+
+  TEST_CASE("piped_writer") {
+    auto reader = PipedReader<SharedBuffer>();
+    auto writer = PipedWriter<SharedBuffer>(Ref(reader));
+    WriteChain(writer, BufferChain{BufferFromString<SharedBuffer>("abc"),
+      BufferFromString<SharedBuffer>("def")});
+    auto buffer = SharedBuffer();
+    reader.Read(Store(buffer));
+    REQUIRE(buffer == "abcdef");
+  }
+
+  TEST_CASE("inline_piped_writer") {
+    auto reader = PipedReader<InlineBuffer<16>>();
+    auto writer = PipedWriter<InlineBuffer<16>>(Ref(reader));
+    WriteChain(writer, BufferChain{BufferFromString<SharedBuffer>("abc"),
+      BufferFromString<SharedBuffer>("def")});
+    auto buffer = SharedBuffer();
+    reader.Read(Store(buffer));
+    REQUIRE(buffer == "abcdef");
+  }
+
+  TEST_CASE("size_declarative_writer") {
+    auto reader = PipedReader<SharedBuffer>();
+    auto writer = SizeDeclarativeWriter(
+      std::make_unique<PipedWriter<SharedBuffer>>(Ref(reader)));
+    writer.Write(BufferFromString<SharedBuffer>("abc"));
+    writer.Write(BufferChain{BufferFromString<SharedBuffer>("de"),
+      BufferFromString<SharedBuffer>("f")});
+    for(auto i = 0; i != 2; ++i) {
+      auto buffer = SharedBuffer();
+      reader.Read(Store(buffer));
+      REQUIRE(buffer.GetSize() == sizeof(std::uint32_t) + 3);
+      REQUIRE(FromLittleEndian(buffer.Extract<std::uint32_t>(0)) == 3);
+      REQUIRE(std::string(buffer.GetData() + sizeof(std::uint32_t), 3) ==
+        (i == 0 ? "abc" : "def"));
+    }
+  }
+
+  TEST_CASE("async_writer") {
+    auto reader = PipedReader<SharedBuffer>();
+    auto writer = AsyncWriter(
+      std::make_unique<PipedWriter<SharedBuffer>>(Ref(reader)));
+    writer.Write(BufferChain{BufferFromString<SharedBuffer>("hello "),
+      BufferFromString<SharedBuffer>("world")});
+    auto buffer = SharedBuffer();
+    reader.Read(Store(buffer));
+    REQUIRE(buffer == "hello world");
+  }
+}
@@ -0,0 +1,90 @@
+#include <thread>
+#include <doctest/doctest.h>
+#include "Beam/IO/BufferPool.hpp"
+#include "Beam/IO/SharedBuffer.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+
+TEST_SUITE("BufferPool") {
+  TEST_CASE("block_size") {
+    REQUIRE(BufferPool::GetBlockSize(0) == BufferPool::MIN_BLOCK_SIZE);
+    REQUIRE(BufferPool::GetBlockSize(1) == BufferPool::MIN_BLOCK_SIZE);
+    REQUIRE(BufferPool::GetBlockSize(64) == 64);
+    REQUIRE(BufferPool::GetBlockSize(65) == 128);
+    REQUIRE(BufferPool::GetBlockSize(3000) == 4096);
+  }
+
+  TEST_CASE("reuse") {
+    auto& pool = BufferPool::GetInstance();
+    auto blockSize = BufferPool::GetBlockSize(200);
+    auto block = pool.Allocate(blockSize);
+    auto statistics = pool.GetStatistics();
+    pool.Deallocate(block, blockSize);
+    REQUIRE(pool.GetStatistics().m_outstandingBytes ==
+      statistics.m_outstandingBytes - static_cast<std::int64_t>(blockSize));
+    auto reusedBlock = pool.Allocate(blockSize);
+    REQUIRE(reusedBlock == block);
+    auto reusedStatistics = pool.GetStatistics();
+    REQUIRE(reusedStatistics.m_allocations == statistics.m_allocations + 1);
+    REQUIRE(reusedStatistics.m_hits == statistics.m_hits + 1);
+    REQUIRE(reusedStatistics.m_outstandingBytes ==
+      statistics.m_outstandingBytes);
+    pool.Deallocate(reusedBlock, blockSize);
+  }
+
+  TEST_CASE("large_block") {
+    auto& pool = BufferPool::GetInstance();
+    auto blockSize = BufferPool::GetBlockSize(2 * BufferPool::MAX_BLOCK_SIZE);
+    auto statistics = pool.GetStatistics();
+    auto block = pool.Allocate(blockSize);
+    pool.Deallocate(block, blockSize);
+    auto block2 = pool.Allocate(blockSize);
+    pool.Deallocate(block2, blockSize);
+    auto updatedStatistics = pool.GetStatistics();
+    REQUIRE(updatedStatistics.m_allocations == statistics.m_allocations + 2);
+    REQUIRE(updatedStatistics.m_hits == statistics.m_hits);
+    REQUIRE(updatedStatistics.m_retainedBytes == statistics.m_retainedBytes);
+  }
+
+  TEST_CASE("cross_thread") {
+    auto& pool = BufferPool::GetInstance();
+    auto blockSize = BufferPool::GetBlockSize(1000);
+    auto statistics = pool.GetStatistics();
+    auto block = static_cast<void*>(nullptr);
+    auto allocator = std::thread([&] {
+      block = pool.Allocate(blockSize);
+    });
+    allocator.join();
+    REQUIRE(pool.GetStatistics().m_outstandingBytes ==
+      statistics.m_outstandingBytes + static_cast<std::int64_t>(blockSize));
+    auto deallocator = std::thread([&] {
+      pool.Deallocate(block, blockSize);
+    });
+    deallocator.join();
+    auto updatedStatistics = pool.GetStatistics();
+    REQUIRE(updatedStatistics.m_outstandingBytes ==
+      statistics.m_outstandingBytes);
+    REQUIRE(updatedStatistics.m_retainedBytes >=
+      statistics.m_retainedBytes + static_cast<std::int64_t>(blockSize));
+    REQUIRE(pool.Allocate(blockSize) == block);
+    pool.Deallocate(block, blockSize);
+  }
+
+  TEST_CASE("shared_buffer") {
+    auto& pool = BufferPool::GetInstance();
+    auto statistics = pool.GetStatistics();
+    {
+      auto buffer = SharedBuffer();
+      buffer.Append("hello", 5);
+      auto copy = buffer;
+      REQUIRE(pool.GetStatistics().m_allocations ==
+        statistics.m_allocations + 1);
+    }
+    REQUIRE(pool.GetStatistics().m_outstandingBytes ==
+      statistics.m_outstandingBytes);
+    auto buffer = SharedBuffer();
+    buffer.Append("world", 5);
+    REQUIRE(pool.GetStatistics().m_hits > statistics.m_hits);
+  }
+}
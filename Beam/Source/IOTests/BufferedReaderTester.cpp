@@ -0,0 +1,85 @@
+#include <string>
+#include <doctest/doctest.h>
+#include "Beam/IO/BufferedReader.hpp"
+#include "Beam/IO/BufferReader.hpp"
+#include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/IO/SharedBuffer.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+
+namespace {
+  SharedBuffer MakeSource(std::size_t size) {
+    auto source = SharedBuffer();
+    for(auto i = std::size_t(0); i != size; ++i) {
+      source.Append(static_cast<char>('a' + i % 26));
+    }
+    return source;
+  }
+}
+
+TEST_SUITE("BufferedReader") {
+  TEST_CASE("empty_source") {
+    auto reader = BufferedReader<BufferReader<SharedBuffer>>(
+      Initialize(SharedBuffer()));
+    auto buffer = SharedBuffer();
+    REQUIRE_THROWS_AS(reader.Read(Store(buffer)), EndOfFileException);
+  }
+
+  TEST_CASE("small_reads") {
+    auto source = MakeSource(1000);
+    auto reader = BufferedReader<BufferReader<SharedBuffer>>(
+      Initialize(source), 4096, 65536);
+    auto buffer = SharedBuffer();
+    for(auto i = 0; i != 100; ++i) {
+      auto header = char();
+      REQUIRE(reader.Read(&header, 1) == 1);
+      buffer.Append(header);
+      REQUIRE(reader.Read(Store(buffer), 9) == 9);
+    }
+    REQUIRE(buffer == source);
+    auto statistics = reader.GetStatistics();
+    REQUIRE(statistics.m_reads == 200);
+    REQUIRE(statistics.m_sourceReads == 1);
+    REQUIRE(!reader.IsDataAvailable());
+  }
+
+  TEST_CASE("grow_with_message_size") {
+    auto source = MakeSource(100000);
+    auto reader = BufferedReader<BufferReader<SharedBuffer>>(
+      Initialize(source), 1024, 65536);
+    auto buffer = SharedBuffer();
+    while(buffer.GetSize() != source.GetSize()) {
+      reader.Read(Store(buffer),
+        std::min<std::size_t>(5000, source.GetSize() - buffer.GetSize()));
+    }
+    REQUIRE(buffer == source);
+    auto statistics = reader.GetStatistics();
+    REQUIRE(statistics.m_readAheadSize == 16384);
+    REQUIRE(statistics.m_sourceReads <= 8);
+  }
+
+  TEST_CASE("read_through") {
+    auto source = MakeSource(10000);
+    auto reader = BufferedReader<BufferReader<SharedBuffer>>(
+      Initialize(source), 1024, 4096);
+    auto buffer = SharedBuffer();
+    REQUIRE(reader.Read(Store(buffer), 8000) == 8000);
+    REQUIRE(reader.GetStatistics().m_sourceReads == 1);
+    REQUIRE(reader.Read(Store(buffer), 2000) == 2000);
+    REQUIRE(buffer == source);
+  }
+
+  TEST_CASE("decay") {
+    auto source = MakeSource(200000);
+    auto reader = BufferedReader<BufferReader<SharedBuffer>>(
+      Initialize(source), 1024, 65536);
+    auto buffer = SharedBuffer();
+    reader.Read(Store(buffer), 4000);
+    REQUIRE(reader.GetStatistics().m_readAheadSize == 8192);
+    for(auto i = 0; i != 1024; ++i) {
+      reader.Read(Store(buffer), 10);
+    }
+    REQUIRE(reader.GetStatistics().m_readAheadSize == 4096);
+  }
+}
@@ -0,0 +1,100 @@
+#include <cstring>
+#include <string>
+#include <doctest/doctest.h>
+#include "Beam/IO/BufferSlice.hpp"
+#include "Beam/IO/InlineBuffer.hpp"
+#include "Beam/IO/NullWriter.hpp"
+#include "Beam/Serialization/BinaryReceiver.hpp"
+#include "Beam/Serialization/BinarySender.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Serialization;
+
+TEST_SUITE("InlineBuffer") {
+  TEST_CASE("append_inline") {
+    auto buffer = InlineBuffer<16>();
+    REQUIRE(buffer.IsEmpty());
+    buffer.Append("hello", 5);
+    buffer.Append(std::uint32_t(7));
+    REQUIRE(buffer.IsInline());
+    REQUIRE(buffer.GetSize() == 9);
+    REQUIRE(std::memcmp(buffer.GetData(), "hello", 5) == 0);
+    REQUIRE(buffer.Extract<std::uint32_t>(5) == 7);
+  }
+
+  TEST_CASE("spill") {
+    auto buffer = InlineBuffer<16>("0123456789", 10);
+    buffer.Append("abcdefghij", 10);
+    REQUIRE(!buffer.IsInline());
+    REQUIRE(buffer == std::string("0123456789abcdefghij"));
+    buffer.Write(20, "z", 1);
+    REQUIRE(buffer == std::string("0123456789abcdefghijz"));
+    buffer.Reset();
+    REQUIRE(buffer.IsInline());
+    REQUIRE(buffer.IsEmpty());
+  }
+
+  TEST_CASE("grow_and_shrink") {
+    auto buffer = InlineBuffer<8>();
+    buffer.Grow(8);
+    REQUIRE(buffer.IsInline());
+    std::memcpy(buffer.GetMutableData(), "abcdefgh", 8);
+    buffer.ShrinkFront(3);
+    REQUIRE(buffer == std::string("defgh"));
+    buffer.Shrink(2);
+    REQUIRE(buffer == std::string("def"));
+    buffer.Grow(10);
+    REQUIRE(!buffer.IsInline());
+    REQUIRE(buffer.GetSize() == 13);
+    REQUIRE(std::memcmp(buffer.GetData(), "def", 3) == 0);
+  }
+
+  TEST_CASE("copy") {
+    auto small = InlineBuffer<16>("abc", 3);
+    auto smallCopy = small;
+    small.Append("d", 1);
+    REQUIRE(smallCopy == std::string("abc"));
+    REQUIRE(small == std::string("abcd"));
+    auto large = InlineBuffer<4>("abcdefgh", 8);
+    auto largeCopy = large;
+    REQUIRE(largeCopy.GetData() == large.GetData());
+    large.Write(0, "x", 1);
+    REQUIRE(largeCopy == std::string("abcdefgh"));
+    REQUIRE(large == std::string("xbcdefgh"));
+    auto moved = std::move(smallCopy);
+    REQUIRE(moved == std::string("abc"));
+    REQUIRE(smallCopy.IsEmpty());
+  }
+
+  TEST_CASE("views") {
+    auto buffer = InlineBuffer<>("header:payload", 14);
+    auto view = BufferView(buffer);
+    REQUIRE(view.GetSize() == 14);
+    auto slice = BufferSlice(Ref(buffer), 7);
+    REQUIRE(slice.GetSize() == 7);
+    REQUIRE(std::memcmp(slice.GetData(), "payload", 7) == 0);
+    auto shared = SharedBuffer();
+    shared.Append(buffer);
+    REQUIRE(shared == buffer);
+    auto writer = NullWriter();
+    writer.Write(buffer);
+  }
+
+  TEST_CASE("binary_sender") {
+    auto buffer = InlineBuffer<>();
+    auto sender = BinarySender<InlineBuffer<>>();
+    sender.SetSink(Ref(buffer));
+    sender.Send(std::string("hello"));
+    sender.Send(123);
+    REQUIRE(buffer.IsInline());
+    auto receiver = BinaryReceiver<InlineBuffer<>>();
+    receiver.SetSource(Ref(buffer));
+    auto text = std::string();
+    auto value = 0;
+    receiver.Shuttle(text);
+    receiver.Shuttle(value);
+    REQUIRE(text == "hello");
+    REQUIRE(value == 123);
+  }
+}
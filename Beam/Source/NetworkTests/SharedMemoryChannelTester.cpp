@@ -0,0 +1,137 @@
+#ifndef _WIN32
+#include <atomic>
+#include <filesystem>
+#include <string>
+#include <unistd.h>
+#include <doctest/doctest.h>
+#include "Beam/IO/BufferChain.hpp"
+#include "Beam/IO/EndOfFileException.hpp"
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Network/SharedMemoryServerConnection.hpp"
+#include "Beam/Routines/RoutineHandler.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Network;
+using namespace Beam::Routines;
+
+namespace {
+  struct TemporaryPath {
+    std::string m_path;
+
+    TemporaryPath()
+      : m_path(MakePath()) {}
+
+    ~TemporaryPath() {
+      auto error = std::error_code();
+      std::filesystem::remove(m_path, error);
+    }
+
+    static std::string MakePath() {
+      static auto nextId = std::atomic_int(0);
+      return (std::filesystem::temp_directory_path() /
+        ("SharedMemoryChannelTester." + std::to_string(::getpid()) + "." +
+          std::to_string(++nextId) + ".sock")).string();
+    }
+  };
+
+  template<typename Reader>
+  std::string ReadExactly(Reader& reader, std::size_t size) {
+    auto buffer = SharedBuffer();
+    while(buffer.GetSize() != size) {
+      reader.Read(Store(buffer), size - buffer.GetSize());
+    }
+    return std::string(buffer.GetData(), buffer.GetSize());
+  }
+}
+
+TEST_SUITE("SharedMemoryChannel") {
+  TEST_CASE("echo") {
+    auto path = TemporaryPath();
+    auto server = SharedMemoryServerConnection(path.m_path);
+    auto serverRoutine = RoutineHandler(Spawn([&] {
+      auto channel = server.Accept();
+      auto message = ReadExactly(channel->GetReader(), 11);
+      channel->GetWriter().Write(BufferFromString<SharedBuffer>(message));
+    }));
+    auto client = SharedMemoryChannel(path.m_path);
+    REQUIRE(client.GetIdentifier().GetName() == path.m_path);
+    client.GetWriter().Write(BufferChain{
+      BufferFromString<SharedBuffer>("hello"),
+      BufferFromString<SharedBuffer>(" world")});
+    REQUIRE(ReadExactly(client.GetReader(), 11) == "hello world");
+    serverRoutine.Wait();
+  }
+
+  TEST_CASE("wrap_around") {
+    auto path = TemporaryPath();
+    auto server = SharedMemoryServerConnection(path.m_path, 64);
+    auto message = std::string();
+    for(auto i = 0; i != 10000; ++i) {
+      message += static_cast<char>('a' + i % 26);
+    }
+    auto received = std::string();
+    auto serverRoutine = RoutineHandler(Spawn([&] {
+      auto channel = server.Accept();
+      received = ReadExactly(channel->GetReader(), message.size());
+    }));
+    auto client = SharedMemoryChannel(path.m_path);
+    client.GetWriter().Write(message.data(), message.size());
+    serverRoutine.Wait();
+    REQUIRE(received == message);
+  }
+
+  TEST_CASE("full_duplex") {
+    auto path = TemporaryPath();
+    auto server = SharedMemoryServerConnection(path.m_path, 64);
+    auto message = std::string();
+    for(auto i = 0; i != 100000; ++i) {
+      message += static_cast<char>('a' + i % 26);
+    }
+    auto serverReceived = std::string();
+    auto serverRoutine = RoutineHandler(Spawn([&] {
+      auto channel = server.Accept();
+      auto writer = RoutineHandler(Spawn([&] {
+        channel->GetWriter().Write(message.data(), message.size());
+      }));
+      serverReceived = ReadExactly(channel->GetReader(), message.size());
+      writer.Wait();
+    }));
+    auto client = SharedMemoryChannel(path.m_path);
+    auto writer = RoutineHandler(Spawn([&] {
+      client.GetWriter().Write(message.data(), message.size());
+    }));
+    auto clientReceived = ReadExactly(client.GetReader(), message.size());
+    writer.Wait();
+    serverRoutine.Wait();
+    REQUIRE(clientReceived == message);
+    REQUIRE(serverReceived == message);
+  }
+
+  TEST_CASE("close") {
+    auto path = TemporaryPath();
+    auto server = SharedMemoryServerConnection(path.m_path);
+    auto isClosed = false;
+    auto serverRoutine = RoutineHandler(Spawn([&] {
+      auto channel = server.Accept();
+      REQUIRE(ReadExactly(channel->GetReader(), 3) == "abc");
+      try {
+        ReadExactly(channel->GetReader(), 1);
+      } catch(const EndOfFileException&) {
+        isClosed = true;
+      }
+    }));
+    auto client = SharedMemoryChannel(path.m_path);
+    client.GetWriter().Write("abc", 3);
+    client.GetConnection().Close();
+    serverRoutine.Wait();
+    REQUIRE(isClosed);
+    REQUIRE_THROWS_AS(client.GetWriter().Write("d", 1), EndOfFileException);
+  }
+
+  TEST_CASE("server_unavailable") {
+    auto path = TemporaryPath();
+    REQUIRE_THROWS_AS(SharedMemoryChannel(path.m_path), ConnectException);
+  }
+}
+#endif
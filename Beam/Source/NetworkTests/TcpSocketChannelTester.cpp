@@ -0,0 +1,65 @@
+#include <string>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/IO/BufferChain.hpp"
+#include "Beam/IO/BufferedReader.hpp"
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Network/TcpServerSocket.hpp"
+#include "Beam/Network/TcpSocketChannel.hpp"
+#include "Beam/Routines/RoutineHandlerGroup.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Network;
+using namespace Beam::Routines;
+
+namespace {
+  const auto MESSAGE = std::string("hello world");
+
+  template<typename Reader>
+  std::string ReadMessage(Reader& reader) {
+    auto buffer = SharedBuffer();
+    ReadExactSize(reader, Store(buffer), MESSAGE.size());
+    return std::string(buffer.GetData(), buffer.GetSize());
+  }
+}
+
+TEST_SUITE("TcpSocketChannel") {
+  TEST_CASE("echo") {
+    const auto CLIENT_COUNT = std::size_t(4);
+    auto server = TcpServerSocket(IpAddress("127.0.0.1", 0));
+    auto address = server.GetAddress();
+    REQUIRE(address.GetPort() != 0);
+    auto routines = RoutineHandlerGroup();
+    routines.Spawn([&] {
+      for(auto i = std::size_t(0); i != CLIENT_COUNT; ++i) {
+        auto channel = std::shared_ptr(server.Accept());
+        routines.Spawn([=] {
+          auto reader = BufferedReader(&channel->GetReader());
+          auto message = ReadMessage(reader);
+          channel->GetWriter().Write(BufferFromString<SharedBuffer>(message));
+        });
+      }
+    });
+    auto replies = std::vector<std::string>(CLIENT_COUNT);
+    for(auto i = std::size_t(0); i != CLIENT_COUNT; ++i) {
+      routines.Spawn([&, i] {
+        auto options = TcpSocketOptions();
+        if(i % 2 == 0) {
+          options.m_shard = i;
+        }
+        auto channel = TcpSocketChannel(address, options);
+        channel.GetWriter().Write(BufferChain{
+          BufferFromString<SharedBuffer>("hello"),
+          BufferFromString<SharedBuffer>(" world")});
+        replies[i] = ReadMessage(channel.GetReader());
+        channel.GetConnection().Close();
+      });
+    }
+    routines.Wait();
+    server.Close();
+    for(auto& reply : replies) {
+      REQUIRE(reply == MESSAGE);
+    }
+  }
+}
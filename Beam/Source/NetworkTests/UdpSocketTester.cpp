@@ -0,0 +1,49 @@
+#include <string>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/IO/SharedBuffer.hpp"
+#include "Beam/Network/UdpSocket.hpp"
+
+using namespace Beam;
+using namespace Beam::IO;
+using namespace Beam::Network;
+
+namespace {
+  UdpSocketOptions MakeOptions() {
+    auto options = UdpSocketOptions();
+    options.m_receiveBufferSize = 1024 * 1024;
+    return options;
+  }
+}
+
+TEST_SUITE("UdpSocket") {
+  TEST_CASE("batch") {
+    auto receiver = UdpSocket(IpAddress("127.0.0.1", 0),
+      IpAddress("127.0.0.1", 0), MakeOptions());
+    auto address = receiver.GetInterface();
+    REQUIRE(address.GetPort() != 0);
+    auto sender = UdpSocket(address, MakeOptions());
+    const auto PACKET_COUNT = 32;
+    auto packets = std::vector<DatagramPacket<SharedBuffer>>();
+    for(auto i = 0; i != PACKET_COUNT; ++i) {
+      packets.emplace_back(
+        BufferFromString<SharedBuffer>(std::to_string(i)), address);
+    }
+    sender.GetSender().Send(packets);
+    auto received = std::vector<DatagramPacket<SharedBuffer>>();
+    while(received.size() != PACKET_COUNT) {
+      auto count = receiver.GetReceiver().Receive(Store(received), 10);
+      REQUIRE(count != 0);
+      REQUIRE(count <= 10);
+    }
+    for(auto i = 0; i != PACKET_COUNT; ++i) {
+      REQUIRE(received[i].GetData() == std::to_string(i));
+      REQUIRE(received[i].GetAddress().GetHost() == "127.0.0.1");
+      REQUIRE(received[i].GetAddress() == received[0].GetAddress());
+    }
+    sender.GetSender().Send(packets.front());
+    received.clear();
+    REQUIRE(receiver.GetReceiver().Receive(Store(received), 10) == 1);
+    REQUIRE(received.front().GetData() == "0");
+  }
+}
@@ -1,5 +1,6 @@
 #include <doctest/doctest.h>
 #include "Beam/Queues/AggregateQueueReader.hpp"
+#include "Beam/Queues/SpscQueue.hpp"
 
 using namespace Beam;
 
@@ -90,4 +91,43 @@ TEST_SUITE("AggregateQueueReader") {
     REQUIRE(source1->IsBroken());
     REQUIRE(source2->IsBroken());
   }
+
+  TEST_CASE("fairness") {
+    auto source1 = std::make_shared<Queue<int>>();
+    auto source2 = std::make_shared<Queue<int>>();
+    auto queues = std::vector<ScopedQueueReader<int>>();
+    queues.push_back(source1);
+    queues.push_back(source2);
+    auto queue = AggregateQueueReader(std::move(queues));
+    for(auto i = 0; i != 3; ++i) {
+      source1->Push(1);
+    }
+    for(auto i = 0; i != 3; ++i) {
+      source2->Push(2);
+    }
+    auto pops = std::vector<int>();
+    for(auto i = 0; i != 6; ++i) {
+      pops.push_back(queue.Pop());
+    }
+    REQUIRE(pops == std::vector{1, 2, 1, 2, 1, 2});
+    REQUIRE(!queue.TryPop());
+  }
+
+  TEST_CASE("forwarded_source") {
+    auto source1 = std::make_shared<Queue<int>>();
+    auto source2 = std::make_shared<SpscQueue<int>>();
+    auto queues = std::vector<ScopedQueueReader<int>>();
+    queues.push_back(source1);
+    queues.push_back(source2);
+    auto queue = AggregateQueueReader(std::move(queues));
+    source1->Push(1);
+    source2->Push(2);
+    auto pops = std::vector<int>();
+    pops.push_back(queue.Pop());
+    pops.push_back(queue.Pop());
+    REQUIRE(IsPermutation(pops, {1, 2}));
+    source1->Break();
+    source2->Break();
+    REQUIRE_THROWS_AS(queue.Pop(), PipeBrokenException);
+  }
 }
@@ -0,0 +1,78 @@
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/Queues/BoundedQueue.hpp"
+#include "Beam/Routines/RoutineHandler.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+TEST_SUITE("BoundedQueue") {
+  TEST_CASE("block") {
+    auto q = BoundedQueue<int>(2, OverflowPolicy::BLOCK);
+    auto count = 100;
+    auto writer = RoutineHandler(Spawn(
+      [&] {
+        for(auto i = 0; i != count; ++i) {
+          q.Push(i);
+        }
+      }));
+    for(auto i = 0; i != count; ++i) {
+      REQUIRE(q.Pop() == i);
+    }
+    writer.Wait();
+    REQUIRE(q.GetHighWaterMark() == 2);
+    REQUIRE(q.GetDropCount() == 0);
+  }
+
+  TEST_CASE("break_waiting_writer") {
+    auto q = BoundedQueue<int>(1, OverflowPolicy::BLOCK);
+    q.Push(1);
+    auto isBroken = false;
+    auto writer = RoutineHandler(Spawn(
+      [&] {
+        try {
+          q.Push(2);
+        } catch(const PipeBrokenException&) {
+          isBroken = true;
+        }
+      }));
+    q.Break();
+    writer.Wait();
+    REQUIRE(isBroken);
+    REQUIRE(q.Pop() == 1);
+    REQUIRE(q.IsBroken());
+  }
+
+  TEST_CASE("drop_oldest") {
+    auto q = BoundedQueue<int>(2, OverflowPolicy::DROP_OLDEST);
+    q.Push(1);
+    q.Push(2);
+    q.Push(3);
+    REQUIRE(q.GetSize() == 2);
+    REQUIRE(q.GetDropCount() == 1);
+    REQUIRE(q.Pop() == 2);
+    REQUIRE(q.Pop() == 3);
+  }
+
+  TEST_CASE("drop_newest") {
+    auto q = BoundedQueue<int>(2, OverflowPolicy::DROP_NEWEST);
+    q.Push(1);
+    q.Push(2);
+    q.Push(3);
+    REQUIRE(q.GetDropCount() == 1);
+    auto values = std::vector<int>();
+    REQUIRE(q.TryPopAll(Store(values)));
+    REQUIRE(values == std::vector{1, 2});
+    REQUIRE(q.GetHighWaterMark() == 2);
+  }
+
+  TEST_CASE("break_on_overflow") {
+    auto q = BoundedQueue<int>(1, OverflowPolicy::BREAK);
+    q.Push(1);
+    REQUIRE_THROWS_AS(q.Push(2), PipeBrokenException);
+    REQUIRE(!q.IsBroken());
+    REQUIRE(q.Pop() == 1);
+    REQUIRE(q.IsBroken());
+    REQUIRE_THROWS_AS(q.Pop(), PipeBrokenException);
+  }
+}
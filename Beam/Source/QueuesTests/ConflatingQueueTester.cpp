@@ -0,0 +1,55 @@
+#include <string>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/Queues/ConflatingQueue.hpp"
+#include "Beam/Routines/RoutineHandler.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+TEST_SUITE("ConflatingQueue") {
+  TEST_CASE("conflate") {
+    auto q = ConflatingQueue<std::string, int>();
+    q.Push(KeyValuePair(std::string("A"), 1));
+    q.Push(KeyValuePair(std::string("B"), 2));
+    q.Push(KeyValuePair(std::string("A"), 3));
+    REQUIRE(q.GetSize() == 2);
+    REQUIRE(q.Pop() == KeyValuePair(std::string("A"), 3));
+    REQUIRE(q.Pop() == KeyValuePair(std::string("B"), 2));
+    REQUIRE(!q.TryPop());
+    q.Push(KeyValuePair(std::string("A"), 4));
+    REQUIRE(q.Pop() == KeyValuePair(std::string("A"), 4));
+  }
+
+  TEST_CASE("pop_all") {
+    auto q = ConflatingQueue<int, int>();
+    auto values = std::vector<KeyValuePair<int, int>>();
+    REQUIRE(!q.TryPopAll(Store(values)));
+    q.Push(KeyValuePair(3, 1));
+    q.Push(KeyValuePair(1, 2));
+    q.Push(KeyValuePair(3, 5));
+    q.Push(KeyValuePair(2, 6));
+    q.PopAll(Store(values));
+    REQUIRE(values == std::vector{KeyValuePair(3, 5), KeyValuePair(1, 2),
+      KeyValuePair(2, 6)});
+    REQUIRE(q.GetSize() == 0);
+  }
+
+  TEST_CASE("break") {
+    auto q = ConflatingQueue<int, int>();
+    auto isBroken = false;
+    auto reader = RoutineHandler(Spawn(
+      [&] {
+        try {
+          q.Pop();
+        } catch(const PipeBrokenException&) {
+          isBroken = true;
+        }
+      }));
+    q.Break();
+    reader.Wait();
+    REQUIRE(isBroken);
+    REQUIRE(q.IsBroken());
+    REQUIRE_THROWS_AS(q.Push(KeyValuePair(1, 1)), PipeBrokenException);
+  }
+}
@@ -1,4 +1,5 @@
 #include <string>
+#include <vector>
 #include <doctest/doctest.h>
 #include "Beam/Queues/ConverterQueueReader.hpp"
 #include "Beam/Queues/Queue.hpp"
@@ -27,4 +28,21 @@ TEST_SUITE("ConverterQueueReader") {
     }
     REQUIRE(source->IsBroken());
   }
+
+  TEST_CASE("pop_all") {
+    auto source = std::make_shared<Queue<int>>();
+    auto converter = ConverterQueueReader(source,
+      [] (auto value) {
+        return std::to_string(value);
+      });
+    auto values = std::vector<std::string>();
+    REQUIRE(!converter.TryPopAll(Store(values)));
+    source->Push(1);
+    source->Push(2);
+    converter.PopAll(Store(values));
+    REQUIRE(values == std::vector<std::string>{"1", "2"});
+    source->Push(3);
+    REQUIRE(converter.TryPopAll(Store(values)));
+    REQUIRE(values == std::vector<std::string>{"1", "2", "3"});
+  }
 }
@@ -1,4 +1,5 @@
 #include <string>
+#include <vector>
 #include <doctest/doctest.h>
 #include "Beam/Queues/FilteredQueueReader.hpp"
 #include "Beam/Queues/Queue.hpp"
@@ -35,4 +36,28 @@ TEST_SUITE("FilteredQueueReader") {
     }
     REQUIRE(source->IsBroken());
   }
+
+  TEST_CASE("pop_all") {
+    auto source = std::make_shared<Queue<int>>();
+    auto filter = FilteredQueueReader(source,
+      [] (auto value) {
+        return value % 2 == 0;
+      });
+    auto values = std::vector<int>();
+    source->Push(1);
+    source->Push(3);
+    REQUIRE(!filter.TryPopAll(Store(values)));
+    REQUIRE(!source->TryPop());
+    source->Push(2);
+    source->Push(4);
+    source->Push(5);
+    filter.PopAll(Store(values));
+    REQUIRE(values == std::vector{2, 4});
+    source->Push(7);
+    source->Push(6);
+    source->Break();
+    REQUIRE(filter.TryPopAll(Store(values)));
+    REQUIRE(values == std::vector{2, 4, 6});
+    REQUIRE_THROWS_AS(filter.PopAll(Store(values)), PipeBrokenException);
+  }
 }
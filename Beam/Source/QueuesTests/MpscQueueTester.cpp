@@ -0,0 +1,147 @@
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/Queues/MpscQueue.hpp"
+#include "Beam/Routines/RoutineHandler.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+TEST_SUITE("MpscQueue") {
+  TEST_CASE("push_pop") {
+    auto q = MpscQueue<std::string>(4);
+    REQUIRE(q.GetCapacity() == 4);
+    REQUIRE(!q.TryPop());
+    q.Push("a");
+    q.Push(std::string("b"));
+    REQUIRE(*q.TryPop() == "a");
+    REQUIRE(q.Pop() == "b");
+    REQUIRE(!q.TryPop());
+  }
+
+  TEST_CASE("break") {
+    auto q = MpscQueue<int>();
+    q.Push(1);
+    q.Push(2);
+    q.Break();
+    REQUIRE_THROWS_AS(q.Push(3), PipeBrokenException);
+    REQUIRE(!q.IsBroken());
+    REQUIRE(q.Pop() == 1);
+    REQUIRE(q.Pop() == 2);
+    REQUIRE(q.IsBroken());
+    REQUIRE_THROWS_AS(q.Pop(), PipeBrokenException);
+  }
+
+  TEST_CASE("break_waiting_reader") {
+    auto q = MpscQueue<int>();
+    auto exceptionCount = std::atomic_int(0);
+    auto reader = RoutineHandler(Spawn([&] {
+      try {
+        q.Pop();
+      } catch(const PipeBrokenException&) {
+        ++exceptionCount;
+      }
+    }));
+    q.Break();
+    reader.Wait();
+    REQUIRE(exceptionCount == 1);
+  }
+
+  TEST_CASE("break_waiting_writer") {
+    auto q = MpscQueue<int>(2);
+    q.Push(1);
+    q.Push(2);
+    auto exceptionCount = std::atomic_int(0);
+    auto writer = RoutineHandler(Spawn([&] {
+      try {
+        q.Push(3);
+      } catch(const PipeBrokenException&) {
+        ++exceptionCount;
+      }
+    }));
+    q.Break();
+    writer.Wait();
+    REQUIRE(exceptionCount == 1);
+  }
+
+  TEST_CASE("destroy_pending_values") {
+    auto value = std::make_shared<int>(5);
+    {
+      auto q = MpscQueue<std::shared_ptr<int>>();
+      q.Push(value);
+      q.Push(value);
+      REQUIRE(value.use_count() == 3);
+    }
+    REQUIRE(value.use_count() == 1);
+  }
+
+  TEST_CASE("blocking") {
+    const auto PRODUCERS = 4;
+    const auto COUNT = 100000;
+    auto q = MpscQueue<int>(16);
+    auto writers = std::vector<RoutineHandler>();
+    for(auto i = 0; i < PRODUCERS; ++i) {
+      writers.emplace_back(Spawn([&] {
+        for(auto j = 0; j < COUNT; ++j) {
+          q.Push(j);
+        }
+      }));
+    }
+    auto total = std::int64_t(0);
+    auto mismatches = 0;
+    auto reader = RoutineHandler(Spawn([&] {
+      auto last = std::vector<int>(PRODUCERS, -1);
+      for(auto i = 0; i < PRODUCERS * COUNT; ++i) {
+        auto value = q.Pop();
+        total += value;
+        if(PRODUCERS == 1 && value != last[0] + 1) {
+          ++mismatches;
+        }
+        last[0] = value;
+      }
+    }));
+    reader.Wait();
+    writers.clear();
+    REQUIRE(mismatches == 0);
+    REQUIRE(total ==
+      PRODUCERS * (static_cast<std::int64_t>(COUNT) * (COUNT - 1) / 2));
+  }
+
+  TEST_CASE("pop_all") {
+    auto q = MpscQueue<int>(4);
+    auto values = std::vector<int>();
+    REQUIRE(!q.TryPopAll(Store(values)));
+    for(auto i = 0; i != 4; ++i) {
+      q.Push(i);
+    }
+    q.PopAll(Store(values));
+    REQUIRE(values == std::vector{0, 1, 2, 3});
+    q.Push(4);
+    q.Break();
+    REQUIRE(q.TryPopAll(Store(values)));
+    REQUIRE(values == std::vector{0, 1, 2, 3, 4});
+    REQUIRE_THROWS_AS(q.PopAll(Store(values)), PipeBrokenException);
+  }
+
+  TEST_CASE("pop_all_blocking") {
+    auto q = MpscQueue<int>(4);
+    auto count = 1000;
+    auto writer = RoutineHandler(Spawn(
+      [&] {
+        for(auto i = 0; i != count; ++i) {
+          q.Push(i);
+        }
+      }));
+    auto values = std::vector<int>();
+    while(static_cast<int>(values.size()) != count) {
+      q.PopAll(Store(values));
+    }
+    writer.Wait();
+    for(auto i = 0; i != count; ++i) {
+      REQUIRE(values[i] == i);
+    }
+  }
+}
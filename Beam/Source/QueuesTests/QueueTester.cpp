@@ -1,4 +1,5 @@
 #include <atomic>
+#include <vector>
 #include <doctest/doctest.h>
 #include "Beam/Queues/Queue.hpp"
 #include "Beam/Routines/RoutineHandler.hpp"
@@ -31,4 +32,51 @@ TEST_SUITE("Queue") {
     r2.Wait();
     REQUIRE(exceptionCount == 2);
   }
+
+  TEST_CASE("pop_all") {
+    auto q = Queue<int>();
+    auto values = std::vector<int>();
+    REQUIRE(!q.TryPopAll(Store(values)));
+    q.Push(1);
+    q.Push(2);
+    q.Push(3);
+    q.PopAll(Store(values));
+    REQUIRE(values == std::vector{1, 2, 3});
+    REQUIRE(!q.TryPop());
+    q.Push(4);
+    q.Break();
+    REQUIRE(q.TryPopAll(Store(values)));
+    REQUIRE(values == std::vector{1, 2, 3, 4});
+    REQUIRE_THROWS_AS(q.PopAll(Store(values)), PipeBrokenException);
+  }
+
+  TEST_CASE("pop_all_waiting_reader") {
+    auto q = Queue<int>();
+    auto values = std::vector<int>();
+    auto reader = RoutineHandler(Spawn(
+      [&] {
+        q.PopAll(Store(values));
+      }));
+    q.Push(5);
+    reader.Wait();
+    REQUIRE(values == std::vector{5});
+  }
+
+  TEST_CASE("multiple_waiting_readers") {
+    auto q = Queue<int>();
+    auto total = std::atomic_int(0);
+    auto readerA = RoutineHandler(Spawn(
+      [&] {
+        total += q.Pop();
+      }));
+    auto readerB = RoutineHandler(Spawn(
+      [&] {
+        total += q.Pop();
+      }));
+    q.Push(1);
+    q.Push(2);
+    readerA.Wait();
+    readerB.Wait();
+    REQUIRE(total == 3);
+  }
 }
@@ -0,0 +1,43 @@
+#include <doctest/doctest.h>
+#include "Beam/Queues/Queue.hpp"
+#include "Beam/Queues/QueueWriterPublisher.hpp"
+
+using namespace Beam;
+
+TEST_SUITE("QueueWriterPublisher") {
+  TEST_CASE("publish") {
+    auto publisher = QueueWriterPublisher<int>();
+    auto destinationA = std::make_shared<Queue<int>>();
+    auto destinationB = std::make_shared<Queue<int>>();
+    publisher.Monitor(destinationA);
+    publisher.Monitor(destinationB);
+    REQUIRE(publisher.GetSize() == 2);
+    publisher.Push(123);
+    REQUIRE(destinationA->Pop() == 123);
+    REQUIRE(destinationB->Pop() == 123);
+  }
+
+  TEST_CASE("remove_broken_queue") {
+    auto publisher = QueueWriterPublisher<int>();
+    auto destinationA = std::make_shared<Queue<int>>();
+    auto destinationB = std::make_shared<Queue<int>>();
+    publisher.Monitor(destinationA);
+    publisher.Monitor(destinationB);
+    destinationA->Break();
+    publisher.Push(5);
+    REQUIRE(publisher.GetSize() == 1);
+    REQUIRE(destinationB->Pop() == 5);
+  }
+
+  TEST_CASE("break") {
+    auto publisher = QueueWriterPublisher<int>();
+    auto destinationA = std::make_shared<Queue<int>>();
+    publisher.Monitor(destinationA);
+    publisher.Break();
+    REQUIRE(publisher.GetSize() == 0);
+    REQUIRE(destinationA->IsBroken());
+    auto destinationB = std::make_shared<Queue<int>>();
+    publisher.Monitor(destinationB);
+    REQUIRE(destinationB->IsBroken());
+  }
+}
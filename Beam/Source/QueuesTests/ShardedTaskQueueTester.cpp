@@ -0,0 +1,68 @@
+#include <vector>
+#include <boost/thread/mutex.hpp>
+#include <doctest/doctest.h>
+#include "Beam/Queues/ShardedTaskQueue.hpp"
+#include "Beam/Routines/Async.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+TEST_SUITE("ShardedTaskQueue") {
+  TEST_CASE("per_key_order") {
+    auto mutex = boost::mutex();
+    auto values = std::vector<std::vector<int>>(8);
+    auto queue = ShardedTaskQueue<int>(4);
+    REQUIRE(queue.GetShardCount() == 4);
+    for(auto i = 0; i != 100; ++i) {
+      for(auto key = 0; key != 8; ++key) {
+        queue.Push(key, [&, key, i] {
+          auto lock = boost::lock_guard(mutex);
+          values[key].push_back(i);
+        });
+      }
+    }
+    queue.Break();
+    queue.Wait();
+    for(auto& keyValues : values) {
+      REQUIRE(keyValues.size() == 100);
+      for(auto i = 0; i != 100; ++i) {
+        REQUIRE(keyValues[i] == i);
+      }
+    }
+  }
+
+  TEST_CASE("depth") {
+    auto queue = ShardedTaskQueue<int>(1);
+    auto started = Async<void>();
+    auto release = Async<void>();
+    auto releaseEval = release.GetEval();
+    queue.Push(0, [&, startedEval = started.GetEval()] () mutable {
+      startedEval.SetResult();
+      release.Get();
+    });
+    started.Get();
+    REQUIRE(queue.GetDepth(0) == 0);
+    auto counter = 0;
+    queue.Push(0, [&] {
+      ++counter;
+    });
+    queue.Push(1, [&] {
+      ++counter;
+    });
+    REQUIRE(queue.GetShard(0) == 0);
+    REQUIRE(queue.GetShard(1) == 0);
+    REQUIRE(queue.GetDepth(0) == 2);
+    releaseEval.SetResult();
+    queue.Break();
+    queue.Wait();
+    REQUIRE(queue.GetDepth(0) == 0);
+    REQUIRE(counter == 2);
+  }
+
+  TEST_CASE("push_after_break") {
+    auto queue = ShardedTaskQueue<int>(2);
+    queue.Break();
+    REQUIRE_THROWS_AS(queue.Push(0, [] {}), PipeBrokenException);
+    REQUIRE(queue.GetDepth(queue.GetShard(0)) == 0);
+  }
+}
@@ -1,4 +1,5 @@
 #include <atomic>
+#include <vector>
 #include <doctest/doctest.h>
 #include "Beam/Queues/StateQueue.hpp"
 #include "Beam/Routines/RoutineHandler.hpp"
@@ -42,4 +43,19 @@ TEST_SUITE("StateQueue") {
     q.Break();
     REQUIRE_THROWS_AS(q.Peek(), PipeBrokenException);
   }
+
+  TEST_CASE("pop_all") {
+    auto q = StateQueue<int>();
+    auto values = std::vector<int>();
+    REQUIRE(!q.TryPopAll(Store(values)));
+    q.Push(1);
+    q.Push(2);
+    q.PopAll(Store(values));
+    REQUIRE(values == std::vector{2});
+    q.Push(3);
+    REQUIRE(q.TryPopAll(Store(values)));
+    REQUIRE(values == std::vector{2, 3});
+    q.Break();
+    REQUIRE_THROWS_AS(q.PopAll(Store(values)), PipeBrokenException);
+  }
 }
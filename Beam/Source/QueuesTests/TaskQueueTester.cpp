@@ -1,3 +1,7 @@
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
 #include <doctest/doctest.h>
 #include "Beam/Queues/TaskQueue.hpp"
 
@@ -16,4 +20,77 @@ TEST_SUITE("TaskQueue") {
     queue.Pop()();
     REQUIRE(receivedBreak);
   }
+
+  TEST_CASE("slot") {
+    auto queue = TaskQueue();
+    auto values = std::vector<int>();
+    auto slot = queue.GetSlot<int>([&] (auto value) {
+      values.push_back(value);
+    });
+    slot.Push(1);
+    slot.Push(2);
+    HandleTasks(queue);
+    REQUIRE(values == std::vector{1, 2});
+  }
+
+  TEST_CASE("pop_all_tasks") {
+    auto queue = TaskQueue();
+    auto counter = 0;
+    queue.Push([&] {
+      ++counter;
+    });
+    queue.Push(std::function<void ()>([&] {
+      counter += 10;
+    }));
+    queue.Pop()();
+    REQUIRE(counter == 1);
+    queue.Push([&] {
+      counter += 100;
+    });
+    auto tasks = std::vector<Threading::Task>();
+    REQUIRE(queue.TryPopAll(Store(tasks)));
+    REQUIRE(tasks.size() == 2);
+    for(auto& task : tasks) {
+      task();
+    }
+    REQUIRE(counter == 111);
+    REQUIRE(!queue.TryPopAll(Store(tasks)));
+    queue.Break();
+    queue.PopAll(Store(tasks));
+    tasks.back()();
+    REQUIRE_THROWS_AS(queue.PopAll(Store(tasks)), PipeBrokenException);
+  }
+
+  TEST_CASE("multiple_waiters") {
+    auto queue = TaskQueue();
+    auto counter = std::atomic_int(0);
+    auto popper = [&] {
+      queue.Pop()();
+    };
+    auto first = std::thread(popper);
+    auto second = std::thread(popper);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.Push([&] {
+      ++counter;
+    });
+    queue.Push([&] {
+      ++counter;
+    });
+    first.join();
+    second.join();
+    REQUIRE(counter == 2);
+  }
+
+  TEST_CASE("pop_function") {
+    auto queue = TaskQueue();
+    auto counter = 0;
+    auto task = std::function<void ()>([&] {
+      ++counter;
+    });
+    queue.Push(task);
+    auto popped = queue.Pop();
+    REQUIRE(popped.target_type() == task.target_type());
+    popped();
+    REQUIRE(counter == 1);
+  }
 }
@@ -0,0 +1,76 @@
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/Routines/Async.hpp"
+#include "Beam/Routines/RoutineHandler.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+TEST_SUITE("Async") {
+  TEST_CASE("complete_before_get") {
+    auto async = Async<int>();
+    auto eval = async.GetEval();
+    REQUIRE(async.GetState() == BaseAsync::State::PENDING);
+    eval.SetResult(123);
+    REQUIRE(async.GetState() == BaseAsync::State::COMPLETE);
+    REQUIRE(async.Get() == 123);
+    REQUIRE(async.Get() == 123);
+    eval = async.GetEval();
+    REQUIRE(async.GetState() == BaseAsync::State::PENDING);
+    eval.SetException(std::runtime_error("failed"));
+    REQUIRE(async.GetState() == BaseAsync::State::EXCEPTION);
+    REQUIRE_THROWS_AS(async.Get(), std::runtime_error);
+  }
+
+  TEST_CASE("single_waiter") {
+    auto async = Async<int>();
+    auto eval = async.GetEval();
+    auto result = std::atomic_int(0);
+    auto routine = RoutineHandler(Spawn([&] {
+      result = async.Get();
+    }));
+    eval.SetResult(321);
+    routine.Wait();
+    REQUIRE(result == 321);
+  }
+
+  TEST_CASE("multiple_waiters") {
+    for(auto i = 0; i < 100; ++i) {
+      auto async = Async<int>();
+      auto eval = async.GetEval();
+      auto total = std::atomic_int(0);
+      auto routines = std::vector<RoutineHandler>();
+      for(auto j = 0; j < 10; ++j) {
+        routines.emplace_back(Spawn([&] {
+          total += async.Get();
+        }));
+      }
+      if(i % 2 == 0) {
+        Spawn([&] {
+          eval.SetResult(1);
+        });
+      } else {
+        eval.SetResult(1);
+      }
+      routines.clear();
+      REQUIRE(total == 10);
+    }
+  }
+
+  TEST_CASE("external_waiter") {
+    for(auto i = 0; i < 20000; ++i) {
+      auto async = std::make_unique<Async<int>>();
+      auto eval = async->GetEval();
+      auto setter = std::thread([&] {
+        eval.SetResult(i);
+      });
+      REQUIRE(async->Get() == i);
+      async.reset();
+      setter.join();
+    }
+  }
+}
@@ -0,0 +1,93 @@
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/Routines/Coroutine.hpp"
+#include "Beam/Routines/RoutineHandler.hpp"
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+using namespace Beam;
+using namespace Beam::Routines;
+
+namespace {
+  Coroutine<int> Add(Async<int>& a, Async<int>& b) {
+    auto left = co_await a;
+    auto right = co_await b;
+    co_return left + right;
+  }
+
+  Coroutine<int> Double(Async<int>& a, Async<int>& b) {
+    auto sum = co_await Add(a, b);
+    co_return 2 * sum;
+  }
+
+  Coroutine<void> Fail(Async<int>& a) {
+    co_await a;
+    throw std::runtime_error("failed");
+  }
+}
+
+TEST_SUITE("Coroutine") {
+  TEST_CASE("await_async") {
+    auto a = Async<int>();
+    auto b = Async<int>();
+    auto aEval = a.GetEval();
+    auto bEval = b.GetEval();
+    auto result = Async<int>();
+    Spawn(Add(a, b), result.GetEval());
+    aEval.SetResult(3);
+    bEval.SetResult(4);
+    REQUIRE(result.Get() == 7);
+  }
+
+  TEST_CASE("await_coroutine") {
+    auto a = Async<int>();
+    auto b = Async<int>();
+    a.GetEval().SetResult(5);
+    auto bEval = b.GetEval();
+    auto result = Async<int>();
+    Spawn(Double(a, b), result.GetEval(), 0);
+    bEval.SetResult(6);
+    REQUIRE(result.Get() == 22);
+  }
+
+  TEST_CASE("exception") {
+    auto a = Async<int>();
+    auto aEval = a.GetEval();
+    auto result = Async<void>();
+    Spawn(Fail(a), result.GetEval());
+    aEval.SetResult(1);
+    REQUIRE_THROWS_AS(result.Get(), std::runtime_error);
+  }
+
+  TEST_CASE("mixed_with_routines") {
+    auto a = Async<int>();
+    auto b = Async<int>();
+    auto aEval = a.GetEval();
+    auto bEval = b.GetEval();
+    auto result = Async<int>();
+    Spawn(Add(a, b), result.GetEval());
+    auto routine = RoutineHandler(Spawn([&] {
+      aEval.SetResult(10);
+      bEval.SetResult(20);
+    }));
+    REQUIRE(result.Get() == 30);
+  }
+
+  TEST_CASE("many") {
+    const auto COUNT = 10000;
+    auto request = Async<int>();
+    auto requestEval = request.GetEval();
+    auto results = std::vector<Async<int>>(COUNT);
+    for(auto& result : results) {
+      Spawn(Add(request, request), result.GetEval());
+    }
+    requestEval.SetResult(1);
+    auto total = 0;
+    for(auto& result : results) {
+      total += result.Get();
+    }
+    REQUIRE(total == 2 * COUNT);
+  }
+}
+#endif
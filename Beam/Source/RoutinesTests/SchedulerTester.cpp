@@ -0,0 +1,148 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/Routines/RoutineHandler.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+TEST_SUITE("Scheduler") {
+  TEST_CASE("work_stealing") {
+    auto& scheduler = Routines::Details::Scheduler::GetInstance();
+    scheduler.SetWorkStealing(true);
+    REQUIRE(scheduler.IsWorkStealing());
+    auto counter = std::atomic_int(0);
+    auto routines = std::vector<RoutineHandler>();
+    for(auto i = 0; i < 1000; ++i) {
+      routines.emplace_back(Spawn(
+        [&] {
+          for(auto j = 0; j < 10; ++j) {
+            Defer();
+          }
+          ++counter;
+        }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE, 0));
+      routines.emplace_back(Spawn(
+        [&] {
+          for(auto j = 0; j < 10; ++j) {
+            Defer();
+          }
+          ++counter;
+        }));
+    }
+    routines.clear();
+    REQUIRE(counter == 2000);
+    scheduler.SetWorkStealing(false);
+  }
+
+  TEST_CASE("steal_from_busy_context") {
+    auto& scheduler = Routines::Details::Scheduler::GetInstance();
+    if(scheduler.GetThreadCount() < 2) {
+      return;
+    }
+    auto getSteals = [&] {
+      auto steals = std::uint64_t(0);
+      for(auto i = std::size_t(0); i < scheduler.GetThreadCount(); ++i) {
+        steals += scheduler.GetStatistics(i).m_steals;
+      }
+      return steals;
+    };
+    scheduler.SetWorkStealing(true);
+    auto initialSteals = getSteals();
+    auto isBlocking = std::atomic_bool(false);
+    auto blocker = RoutineHandler(Spawn(
+      [&] {
+        isBlocking = true;
+        auto deadline =
+          std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while(getSteals() == initialSteals &&
+          std::chrono::steady_clock::now() < deadline) {}
+      }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE, 0));
+    while(!isBlocking) {}
+    auto counter = std::atomic_int(0);
+    auto routines = std::vector<RoutineHandler>();
+    for(auto i = std::size_t(0); i < 4 * scheduler.GetThreadCount(); ++i) {
+      routines.emplace_back(Spawn(
+        [&] {
+          ++counter;
+        }));
+    }
+    blocker.Wait();
+    routines.clear();
+    REQUIRE(counter == 4 * static_cast<int>(scheduler.GetThreadCount()));
+    REQUIRE(getSteals() > initialSteals);
+    scheduler.SetWorkStealing(false);
+  }
+
+  TEST_CASE("pinned_routines") {
+    auto& scheduler = Routines::Details::Scheduler::GetInstance();
+    scheduler.SetWorkStealing(true);
+    auto mismatches = std::atomic_int(0);
+    auto routines = std::vector<RoutineHandler>();
+    for(auto i = std::size_t(0); i < scheduler.GetThreadCount(); ++i) {
+      for(auto j = 0; j < 100; ++j) {
+        routines.emplace_back(Spawn(
+          [&, i] {
+            auto& routine =
+              static_cast<ScheduledRoutine&>(GetCurrentRoutine());
+            if(!routine.IsPinned()) {
+              ++mismatches;
+            }
+            for(auto k = 0; k < 10; ++k) {
+              Defer();
+              if(routine.GetContextId() != i) {
+                ++mismatches;
+              }
+            }
+          }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE, i));
+      }
+    }
+    routines.clear();
+    REQUIRE(mismatches == 0);
+    scheduler.SetWorkStealing(false);
+  }
+
+  TEST_CASE("pinned_out_of_range") {
+    auto& scheduler = Routines::Details::Scheduler::GetInstance();
+    auto threadCount = scheduler.GetThreadCount();
+    auto contextId = std::size_t(-1);
+    auto routine = RoutineHandler(Spawn(
+      [&] {
+        contextId = static_cast<ScheduledRoutine&>(
+          GetCurrentRoutine()).GetContextId();
+      }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE,
+      2 * threadCount + 1));
+    routine.Wait();
+    REQUIRE(contextId == 1 % threadCount);
+  }
+
+  TEST_CASE("statistics") {
+    auto& scheduler = Routines::Details::Scheduler::GetInstance();
+    scheduler.ResetLongestSlice(0);
+    auto initialStatistics = scheduler.GetStatistics(0);
+    auto routine = RoutineHandler(Spawn(
+      [] {
+        for(auto i = 0; i < 10; ++i) {
+          Defer();
+        }
+        auto start = std::chrono::steady_clock::now();
+        while(std::chrono::steady_clock::now() - start <
+          std::chrono::milliseconds(5)) {}
+      }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE, 0));
+    routine.Wait();
+    auto statistics = scheduler.GetStatistics(0);
+    REQUIRE(statistics.m_timestamp > initialStatistics.m_timestamp);
+    REQUIRE(statistics.m_contextSwitches -
+      initialStatistics.m_contextSwitches >= 11);
+    REQUIRE(statistics.m_longestSlice >= std::chrono::milliseconds(5));
+    auto initialLatencies = std::accumulate(
+      initialStatistics.m_latencies.begin(),
+      initialStatistics.m_latencies.end(), std::uint64_t(0));
+    auto latencies = std::accumulate(statistics.m_latencies.begin(),
+      statistics.m_latencies.end(), std::uint64_t(0));
+    REQUIRE(latencies - initialLatencies ==
+      statistics.m_contextSwitches - initialStatistics.m_contextSwitches);
+  }
+}
@@ -0,0 +1,95 @@
+#include <thread>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/Routines/RoutineHandler.hpp"
+#include "Beam/Routines/StackPool.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+TEST_SUITE("StackPool") {
+  TEST_CASE("reuse") {
+    auto pool = StackPool(StackPool::DEFAULT_RETENTION, false);
+    auto allocator = pool.GetAllocator(65536);
+    auto stack = allocator.allocate();
+    REQUIRE(stack.size >= 65536);
+    auto sp = stack.sp;
+    allocator.deallocate(stack);
+    auto statistics = pool.GetStatistics();
+    REQUIRE(statistics.m_allocations == 1);
+    REQUIRE(statistics.m_hits == 0);
+    REQUIRE(statistics.m_retainedStacks == 1);
+    auto nextAllocator = pool.GetAllocator(40000);
+    auto nextStack = nextAllocator.allocate();
+    REQUIRE(nextStack.sp == sp);
+    statistics = pool.GetStatistics();
+    REQUIRE(statistics.m_allocations == 2);
+    REQUIRE(statistics.m_hits == 1);
+    REQUIRE(statistics.m_retainedStacks == 0);
+    REQUIRE(statistics.m_retainedBytes == 0);
+    nextAllocator.deallocate(nextStack);
+  }
+
+  TEST_CASE("retention") {
+    auto pool = StackPool(65536, false);
+    auto allocator = pool.GetAllocator(65536);
+    auto a = allocator.allocate();
+    auto b = allocator.allocate();
+    allocator.deallocate(a);
+    allocator.deallocate(b);
+    auto statistics = pool.GetStatistics();
+    REQUIRE(statistics.m_retainedStacks == 1);
+    REQUIRE(statistics.m_recycles == 1);
+    REQUIRE(statistics.m_evictions == 1);
+    pool.Clear();
+    REQUIRE(pool.GetStatistics().m_retainedBytes == 0);
+  }
+
+  TEST_CASE("concurrent_retention") {
+    auto pool = StackPool(4 * 65536, false);
+    auto threads = std::vector<std::thread>();
+    for(auto i = 0; i < 4; ++i) {
+      threads.emplace_back([&] {
+        auto allocator = pool.GetAllocator(65536);
+        auto stacks = std::vector<boost::context::stack_context>();
+        for(auto j = 0; j < 16; ++j) {
+          stacks.push_back(allocator.allocate());
+        }
+        for(auto& stack : stacks) {
+          allocator.deallocate(stack);
+        }
+      });
+    }
+    for(auto& thread : threads) {
+      thread.join();
+    }
+    auto statistics = pool.GetStatistics();
+    REQUIRE(statistics.m_retainedBytes <= pool.GetRetention());
+    REQUIRE(statistics.m_recycles + statistics.m_evictions == 64);
+  }
+
+  TEST_CASE("guard_pages") {
+    auto pool = StackPool(StackPool::DEFAULT_RETENTION, true);
+    auto allocator = pool.GetAllocator(65536);
+    auto stack = allocator.allocate();
+    REQUIRE(stack.size > 65536);
+    allocator.deallocate(stack);
+    pool.SetGuardPages(false);
+    auto unguardedAllocator = pool.GetAllocator(65536);
+    auto unguardedStack = unguardedAllocator.allocate();
+    REQUIRE(pool.GetStatistics().m_hits == 0);
+    unguardedAllocator.deallocate(unguardedStack);
+    REQUIRE(pool.GetStatistics().m_retainedStacks == 2);
+  }
+
+  TEST_CASE("scheduler") {
+    auto& pool = Routines::Details::Scheduler::GetInstance().GetStackPool();
+    auto initialStatistics = pool.GetStatistics();
+    for(auto i = 0; i < 100; ++i) {
+      auto routine = RoutineHandler(Spawn([] {}));
+    }
+    auto statistics = pool.GetStatistics();
+    REQUIRE(statistics.m_allocations - initialStatistics.m_allocations == 100);
+    REQUIRE(statistics.m_hits - initialStatistics.m_hits >= 99);
+  }
+}
@@ -0,0 +1,89 @@
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/Routines/RoutineHandler.hpp"
+#include "Beam/Routines/WhenAll.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+TEST_SUITE("WhenAll") {
+  TEST_CASE("completed") {
+    auto a = Async<int>();
+    auto b = Async<std::string>();
+    a.GetEval().SetResult(5);
+    b.GetEval().SetResult("hello");
+    WhenAll(a, b);
+    REQUIRE(a.Get() == 5);
+    REQUIRE(b.Get() == "hello");
+  }
+
+  TEST_CASE("external_waiter") {
+    for(auto i = 0; i < 10000; ++i) {
+      auto a = Async<int>();
+      auto b = Async<int>();
+      auto aEval = a.GetEval();
+      auto bEval = b.GetEval();
+      aEval.SetResult(1);
+      auto setter = std::thread([&] {
+        bEval.SetResult(2);
+      });
+      WhenAll(a, b);
+      setter.join();
+      REQUIRE(b.Get() == 2);
+    }
+  }
+
+  TEST_CASE("pending") {
+    auto a = Async<int>();
+    auto b = Async<int>();
+    auto c = Async<void>();
+    auto aEval = a.GetEval();
+    auto bEval = b.GetEval();
+    auto cEval = c.GetEval();
+    auto isComplete = std::atomic_bool(false);
+    auto routine = RoutineHandler(Spawn([&] {
+      WhenAll(a, b, c);
+      isComplete = true;
+    }));
+    aEval.SetResult(1);
+    cEval.SetResult();
+    REQUIRE(!isComplete);
+    bEval.SetException(std::runtime_error("failed"));
+    routine.Wait();
+    REQUIRE(isComplete);
+    REQUIRE(a.Get() == 1);
+    REQUIRE_THROWS_AS(b.Get(), std::runtime_error);
+  }
+
+  TEST_CASE("vector") {
+    for(auto i = 0; i < 100; ++i) {
+      auto asyncs = std::vector<Async<int>>(10);
+      auto evals = std::vector<Eval<int>>();
+      for(auto& async : asyncs) {
+        evals.push_back(async.GetEval());
+      }
+      auto total = std::atomic_int(0);
+      auto routine = RoutineHandler(Spawn([&] {
+        WhenAll(asyncs);
+        for(auto& async : asyncs) {
+          total += async.Get();
+        }
+      }));
+      for(auto j = std::size_t(0); j < evals.size(); ++j) {
+        Spawn([&, j] {
+          evals[j].SetResult(static_cast<int>(j));
+        });
+      }
+      routine.Wait();
+      REQUIRE(total == 45);
+    }
+  }
+
+  TEST_CASE("empty") {
+    auto asyncs = std::vector<Async<int>>();
+    WhenAll(asyncs);
+  }
+}
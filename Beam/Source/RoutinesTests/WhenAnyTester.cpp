@@ -0,0 +1,115 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Beam/Routines/RoutineHandler.hpp"
+#include "Beam/Routines/WhenAny.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+
+TEST_SUITE("WhenAny") {
+  TEST_CASE("completed") {
+    auto a = Async<int>();
+    auto b = Async<int>();
+    auto bEval = b.GetEval();
+    a.GetEval().SetResult(5);
+    REQUIRE(WhenAny(a, b) == 0);
+    REQUIRE(a.Get() == 5);
+  }
+
+  TEST_CASE("pending") {
+    auto a = Async<int>();
+    auto b = Async<int>();
+    auto aEval = a.GetEval();
+    auto bEval = b.GetEval();
+    auto index = std::atomic_size_t(2);
+    auto routine = RoutineHandler(Spawn([&] {
+      index = WhenAny(a, b);
+    }));
+    bEval.SetResult(7);
+    routine.Wait();
+    REQUIRE(index == 1);
+    REQUIRE(b.Get() == 7);
+    aEval.SetResult(3);
+    REQUIRE(a.Get() == 3);
+  }
+
+  TEST_CASE("vector") {
+    for(auto i = 0; i < 100; ++i) {
+      auto asyncs = std::vector<Async<int>>(10);
+      auto evals = std::vector<Eval<int>>();
+      for(auto& async : asyncs) {
+        evals.push_back(async.GetEval());
+      }
+      auto result = std::atomic_int(-1);
+      auto routine = RoutineHandler(Spawn([&] {
+        auto index = WhenAny(asyncs);
+        result = asyncs[index].Get();
+      }));
+      auto setters = std::vector<RoutineHandler>();
+      for(auto j = std::size_t(0); j < evals.size(); ++j) {
+        setters.emplace_back(Spawn([&, j] {
+          evals[j].SetResult(static_cast<int>(j));
+        }));
+      }
+      routine.Wait();
+      setters.clear();
+      REQUIRE(result >= 0);
+      REQUIRE(result < 10);
+    }
+  }
+
+  TEST_CASE("concurrent_completion") {
+    for(auto i = 0; i < 1000; ++i) {
+      auto a = Async<int>();
+      auto b = Async<int>();
+      auto aEval = a.GetEval();
+      auto bEval = b.GetEval();
+      auto index = std::atomic_size_t(2);
+      auto routine = RoutineHandler(Spawn([&] {
+        index = WhenAny(a, b);
+      }));
+      auto setter = std::thread([&] {
+        aEval.SetResult(1);
+        bEval.SetResult(2);
+      });
+      routine.Wait();
+      setter.join();
+      REQUIRE(index < 2);
+    }
+  }
+
+  TEST_CASE("external_waiter") {
+    for(auto i = 0; i < 10000; ++i) {
+      auto a = Async<int>();
+      auto b = Async<int>();
+      auto aEval = a.GetEval();
+      auto bEval = b.GetEval();
+      auto setter = std::thread([&] {
+        bEval.SetResult(2);
+      });
+      REQUIRE(WhenAny(a, b) == 1);
+      setter.join();
+    }
+  }
+
+  TEST_CASE("shared_waiter") {
+    auto a = Async<int>();
+    auto aEval = a.GetEval();
+    auto b = Async<int>();
+    auto bEval = b.GetEval();
+    auto waiter = RoutineHandler(Spawn([&] {
+      a.Get();
+    }));
+    auto index = std::atomic_size_t(2);
+    auto routine = RoutineHandler(Spawn([&] {
+      index = WhenAny(a, b);
+    }));
+    aEval.SetResult(1);
+    routine.Wait();
+    waiter.Wait();
+    REQUIRE(index == 0);
+    bEval.SetResult(2);
+  }
+}
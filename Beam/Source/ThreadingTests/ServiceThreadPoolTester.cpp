@@ -0,0 +1,41 @@
+#include <doctest/doctest.h>
+#include "Beam/Routines/RoutineHandler.hpp"
+#include "Beam/Threading/ServiceThreadPool.hpp"
+
+using namespace Beam;
+using namespace Beam::Routines;
+using namespace Beam::Threading;
+
+namespace {
+  ThreadPoolConfig MakeConfig(std::size_t threadCount) {
+    auto config = ThreadPoolConfig();
+    config.m_threadCount = threadCount;
+    return config;
+  }
+}
+
+TEST_SUITE("ServiceThreadPool") {
+  TEST_CASE("shard_count") {
+    auto sharedPool = ServiceThreadPool(MakeConfig(3), false);
+    REQUIRE(sharedPool.GetThreadCount() == 3);
+    REQUIRE(sharedPool.GetShardCount() == 1);
+    auto shardedPool = ServiceThreadPool(MakeConfig(3), true);
+    REQUIRE(shardedPool.GetThreadCount() == 3);
+    REQUIRE(shardedPool.GetShardCount() == 3);
+  }
+
+  TEST_CASE("local_shard") {
+    auto pool = ServiceThreadPool(MakeConfig(3), true);
+    REQUIRE(pool.GetLocalShard() == ServiceThreadPool::ANY_SHARD);
+    auto threadCount =
+      Routines::Details::Scheduler::GetInstance().GetThreadCount();
+    for(auto i = std::size_t(0); i != threadCount; ++i) {
+      auto shard = ServiceThreadPool::ANY_SHARD;
+      auto routine = RoutineHandler(Spawn([&] {
+        shard = pool.GetLocalShard();
+      }, Routines::Details::Scheduler::DEFAULT_STACK_SIZE, i));
+      routine.Wait();
+      REQUIRE(shard == i % pool.GetShardCount());
+    }
+  }
+}
@@ -0,0 +1,75 @@
+#include <array>
+#include <functional>
+#include <memory>
+#include <doctest/doctest.h>
+#include "Beam/Threading/Task.hpp"
+
+using namespace Beam::Threading;
+
+TEST_SUITE("Task") {
+  TEST_CASE("empty") {
+    auto task = Task();
+    REQUIRE(!task);
+  }
+
+  TEST_CASE("inline") {
+    auto counter = 0;
+    auto task = Task([&] {
+      ++counter;
+    });
+    REQUIRE(task);
+    task();
+    task();
+    REQUIRE(counter == 2);
+  }
+
+  TEST_CASE("heap") {
+    auto values = std::array<int, 32>();
+    auto task = Task([=, &values] () mutable {
+      values[0] = 1;
+    });
+    task();
+    REQUIRE(values[0] == 1);
+  }
+
+  TEST_CASE("move_only") {
+    auto value = std::make_unique<int>(5);
+    auto result = 0;
+    auto task = Task([&, value = std::move(value)] {
+      result = *value;
+    });
+    auto moved = std::move(task);
+    REQUIRE(!task);
+    moved();
+    REQUIRE(result == 5);
+  }
+
+  TEST_CASE("destroy") {
+    auto value = std::make_shared<int>(0);
+    {
+      auto task = Task([value] {});
+      REQUIRE(value.use_count() == 2);
+      auto heapTask = Task([value, padding = std::array<char, 64>()] {});
+      REQUIRE(value.use_count() == 3);
+      task = std::move(heapTask);
+      REQUIRE(value.use_count() == 2);
+    }
+    REQUIRE(value.use_count() == 1);
+  }
+
+  TEST_CASE("target") {
+    auto counter = 0;
+    auto task = Task(std::function<void ()>([&] {
+      ++counter;
+    }));
+    REQUIRE(task.Target<int>() == nullptr);
+    auto function = task.Target<std::function<void ()>>();
+    REQUIRE(function != nullptr);
+    (*function)();
+    REQUIRE(counter == 1);
+    auto heapFunction = [padding = std::array<char, 64>()] {};
+    auto heapTask = Task(heapFunction);
+    REQUIRE(heapTask.Target<std::function<void ()>>() == nullptr);
+    REQUIRE(heapTask.Target<decltype(heapFunction)>() != nullptr);
+  }
+}
@@ -0,0 +1,57 @@
+#include <atomic>
+#include <system_error>
+#include <doctest/doctest.h>
+#include "Beam/Threading/ThreadAffinity.hpp"
+#include "Beam/Threading/ThreadPoolConfig.hpp"
+#include "Beam/Utilities/YamlConfig.hpp"
+
+using namespace Beam;
+using namespace Beam::Threading;
+using namespace boost::posix_time;
+
+TEST_SUITE("ThreadPoolConfig") {
+  TEST_CASE("thread_count") {
+    auto config = ThreadPoolConfig();
+    REQUIRE(GetThreadCount(config) >= 1);
+    config.m_threadCount = 3;
+    REQUIRE(GetThreadCount(config) == 3);
+  }
+
+  TEST_CASE("spin_wait") {
+    REQUIRE(SpinWait(milliseconds(1), [] { return true; }));
+    REQUIRE(!SpinWait(milliseconds(1), [] { return false; }));
+    auto counter = 0;
+    REQUIRE(SpinWait(seconds(1), [&] { return ++counter == 100; }));
+  }
+
+  TEST_CASE("yaml") {
+    auto config = YamlValueExtractor<ThreadPoolConfig>()(YAML::Load(
+      "threads: 2\n"
+      "cpus: [0]\n"
+      "spin: 5ms\n"));
+    REQUIRE(config.m_threadCount == 2);
+    REQUIRE(config.m_cpus == std::vector{0});
+    REQUIRE(config.m_spinDuration == milliseconds(5));
+    REQUIRE_THROWS_AS(YamlValueExtractor<ThreadPoolConfig>()(YAML::Load(
+      "threads: 1\n"
+      "cpus: [0, 0]\n")), AssertionException);
+    REQUIRE_THROWS_AS(YamlValueExtractor<ThreadPoolConfig>()(YAML::Load(
+      "cpus: [-1]\n")), AssertionException);
+  }
+
+#ifdef __linux__
+  TEST_CASE("pin_failure") {
+    auto isDone = std::atomic_bool(false);
+    auto thread = boost::thread([&] {
+      while(!isDone) {
+        boost::this_thread::yield();
+      }
+    });
+    auto config = ThreadPoolConfig();
+    config.m_cpus.push_back(CPU_SETSIZE - 1);
+    REQUIRE_THROWS_AS(Pin(thread, config, 0), std::system_error);
+    isDone = true;
+    thread.join();
+  }
+#endif
+}
@@ -13,11 +13,13 @@ CALL:build Beam %*
 CALL:build WebApi %*
 CALL:build Applications\AdminClient %*
 CALL:build Applications\ClientTemplate %*
+CALL:build Applications\DatagramProfiler %*
 CALL:build Applications\DataStoreProfiler %*
 CALL:build Applications\HttpFileServer %*
 CALL:build Applications\QueryStressTest %*
 CALL:build Applications\QueueStressTest %*
 CALL:build Applications\RegistryServer %*
+CALL:build Applications\SchedulerProfiler %*
 CALL:build Applications\Scratch %*
 CALL:build Applications\ServiceLocator %*
 CALL:build Applications\ServiceProtocolProfiler %*
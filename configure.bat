@@ -13,11 +13,13 @@ CALL:configure Beam %*
 CALL:configure WebApi %*
 CALL:configure Applications\AdminClient %*
 CALL:configure Applications\ClientTemplate %*
+CALL:configure Applications\DatagramProfiler %*
 CALL:configure Applications\DataStoreProfiler %*
 CALL:configure Applications\HttpFileServer %*
 CALL:configure Applications\QueryStressTest %*
 CALL:configure Applications\QueueStressTest %*
 CALL:configure Applications\RegistryServer %*
+CALL:configure Applications\SchedulerProfiler %*
 CALL:configure Applications\Scratch %*
 CALL:configure Applications\ServiceLocator %*
 CALL:configure Applications\ServiceProtocolProfiler %*
@@ -17,11 +17,13 @@ targets="Beam"
 targets+=" WebApi"
 targets+=" Applications/AdminClient"
 targets+=" Applications/ClientTemplate"
+targets+=" Applications/DatagramProfiler"
 targets+=" Applications/DataStoreProfiler"
 targets+=" Applications/HttpFileServer"
 targets+=" Applications/QueryStressTest"
 targets+=" Applications/QueueStressTest"
 targets+=" Applications/RegistryServer"
+targets+=" Applications/SchedulerProfiler"
 targets+=" Applications/Scratch"
 targets+=" Applications/ServiceLocator"
 targets+=" Applications/ServiceProtocolProfiler"